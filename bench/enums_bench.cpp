@@ -0,0 +1,302 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/enums/enums.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+// generated enums: ordinal ones with values 0 .. N-1, sparse ones with widely spread values. the enumerators are
+// generated in BLOCKS of BLOCK_SIZE elements, as BOOST_PP_REPEAT is limited to 256 iterations
+
+#define NOVA_ENUMS_BENCH_BLOCK_SIZE 4
+
+#define NOVA_ENUMS_BENCH_NAME( block, n )  BOOST_PP_CAT( value_, BOOST_PP_CAT( block, BOOST_PP_CAT( _, n ) ) )
+#define NOVA_ENUMS_BENCH_INDEX( block, n ) ( block * NOVA_ENUMS_BENCH_BLOCK_SIZE + n )
+
+// invokes MACRO( block, n, DATA ) for every element
+#define NOVA_ENUMS_BENCH_REPEAT( BLOCKS, MACRO, DATA ) \
+    BOOST_PP_REPEAT( BLOCKS, NOVA_ENUMS_BENCH_REPEAT_BLOCK, ( MACRO, DATA ) )
+#define NOVA_ENUMS_BENCH_REPEAT_BLOCK( z, block, MACRO_DATA ) \
+    BOOST_PP_REPEAT_##z( NOVA_ENUMS_BENCH_BLOCK_SIZE,         \
+                         NOVA_ENUMS_BENCH_REPEAT_ELEMENT,     \
+                         ( block, BOOST_PP_TUPLE_REM() MACRO_DATA ) )
+#define NOVA_ENUMS_BENCH_REPEAT_ELEMENT( z, n, BLOCK_MACRO_DATA )                           \
+    BOOST_PP_TUPLE_ELEM( 1, BLOCK_MACRO_DATA )( BOOST_PP_TUPLE_ELEM( 0, BLOCK_MACRO_DATA ), \
+                                                n,                                          \
+                                                BOOST_PP_TUPLE_ELEM( 2, BLOCK_MACRO_DATA ) )
+
+#define NOVA_ENUMS_BENCH_ENUMERATOR( block, n, data ) NOVA_ENUMS_BENCH_NAME( block, n ),
+#define NOVA_ENUMS_BENCH_SPARSE_ENUMERATOR( block, n, data ) \
+    NOVA_ENUMS_BENCH_NAME( block, n ) = NOVA_ENUMS_BENCH_INDEX( block, n ) * 1000 + 17,
+
+#define NOVA_ENUMS_BENCH_CASE_TO_STRING( block, n, TYPE ) \
+    case TYPE::NOVA_ENUMS_BENCH_NAME( block, n ):         \
+        return BOOST_PP_STRINGIZE( NOVA_ENUMS_BENCH_NAME( block, n ) );
+
+#define NOVA_ENUMS_BENCH_CASE_IS_VALID( block, n, TYPE ) case int( TYPE::NOVA_ENUMS_BENCH_NAME( block, n ) ):
+
+#define NOVA_ENUMS_BENCH_DEFINE_ENUM( TYPE, BLOCKS, ENUMERATOR )                                    \
+    enum class TYPE                                                                                 \
+    {                                                                                               \
+        NOVA_ENUMS_BENCH_REPEAT( BLOCKS, ENUMERATOR, ~ )                                            \
+    };                                                                                              \
+                                                                                                    \
+    NOVA_ENUMS_REGISTER( TYPE, NOVA_ENUMS_BENCH_REPEAT( BLOCKS, NOVA_ENUMS_BENCH_ENUMERATOR, ~ ) ); \
+                                                                                                    \
+    /* hand-written baselines */                                                                    \
+    [[maybe_unused]] std::string_view switch_to_string( TYPE value )                                \
+    {                                                                                               \
+        switch ( value ) {                                                                          \
+            NOVA_ENUMS_BENCH_REPEAT( BLOCKS, NOVA_ENUMS_BENCH_CASE_TO_STRING, TYPE )                \
+        }                                                                                           \
+        return {};                                                                                  \
+    }                                                                                               \
+                                                                                                    \
+    [[maybe_unused]] bool switch_is_valid( std::type_identity< TYPE >, int value )                  \
+    {                                                                                               \
+        switch ( value ) {                                                                          \
+            NOVA_ENUMS_BENCH_REPEAT( BLOCKS, NOVA_ENUMS_BENCH_CASE_IS_VALID, TYPE )                 \
+            return true;                                                                            \
+        default: return false;                                                                      \
+        }                                                                                           \
+    }
+
+NOVA_ENUMS_BENCH_DEFINE_ENUM( ordinal_4, 1, NOVA_ENUMS_BENCH_ENUMERATOR )
+NOVA_ENUMS_BENCH_DEFINE_ENUM( ordinal_16, 4, NOVA_ENUMS_BENCH_ENUMERATOR )
+NOVA_ENUMS_BENCH_DEFINE_ENUM( ordinal_128, 32, NOVA_ENUMS_BENCH_ENUMERATOR )
+NOVA_ENUMS_BENCH_DEFINE_ENUM( ordinal_1024, 256, NOVA_ENUMS_BENCH_ENUMERATOR )
+
+NOVA_ENUMS_BENCH_DEFINE_ENUM( sparse_4, 1, NOVA_ENUMS_BENCH_SPARSE_ENUMERATOR )
+NOVA_ENUMS_BENCH_DEFINE_ENUM( sparse_16, 4, NOVA_ENUMS_BENCH_SPARSE_ENUMERATOR )
+NOVA_ENUMS_BENCH_DEFINE_ENUM( sparse_128, 32, NOVA_ENUMS_BENCH_SPARSE_ENUMERATOR )
+NOVA_ENUMS_BENCH_DEFINE_ENUM( sparse_1024, 256, NOVA_ENUMS_BENCH_SPARSE_ENUMERATOR )
+
+// same names as `ordinal_128`, compared as `std::string_view` instead of word keys
+enum class string_views_128
+{
+    NOVA_ENUMS_BENCH_REPEAT( 32, NOVA_ENUMS_BENCH_ENUMERATOR, ~ )
+};
+
+template <>
+struct nova::enums::string_compare_strategy< string_views_128 > :
+    std::integral_constant< nova::enums::string_compare, nova::enums::string_compare::string_views >
+{};
+
+NOVA_ENUMS_REGISTER( string_views_128, NOVA_ENUMS_BENCH_REPEAT( 32, NOVA_ENUMS_BENCH_ENUMERATOR, ~ ) );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+using namespace nova::enums;
+
+constexpr size_t number_of_queries = 1024;
+
+// inputs are precomputed and randomly ordered, so that the compiler cannot fold the lookups and the branch predictor
+// cannot learn the access pattern
+template < typename EnumType >
+struct queries
+{
+    queries()
+    {
+        std::mt19937 rng { 42 };
+
+        for ( size_t index = 0; index != number_of_queries; ++index ) {
+            EnumType value = all_enum_values< EnumType >[ rng() % number_of_elements< EnumType > ];
+
+            values.push_back( value );
+            hit_strings.emplace_back( to_string( value ) );
+            miss_strings.emplace_back( std::string( to_string( value ) ) + "_" );
+            hit_ints.push_back( int( to_underlying( value ) ) );
+            miss_ints.push_back( int( to_underlying( value ) ) + 1 );
+        }
+
+        for ( EnumType value : all_enum_values< EnumType > )
+            map.emplace( to_string( value ), value );
+    }
+
+    std::vector< EnumType >    values;
+    std::vector< std::string > hit_strings;
+    std::vector< std::string > miss_strings;
+    std::vector< int >         hit_ints;
+    std::vector< int >         miss_ints;
+
+    std::unordered_map< std::string_view, EnumType > map;
+};
+
+template < typename EnumType >
+void run_benchmarks( const std::string& name )
+{
+    const queries< EnumType > q;
+
+    BENCHMARK( name + " to_string" )
+    {
+        size_t sum = 0;
+        for ( EnumType value : q.values )
+            sum += to_string( value ).size();
+        return sum;
+    };
+
+    BENCHMARK( name + " to_string (switch)" )
+    {
+        size_t sum = 0;
+        for ( EnumType value : q.values )
+            sum += switch_to_string( value ).size();
+        return sum;
+    };
+
+    BENCHMARK( name + " to_enum string hit" )
+    {
+        size_t found = 0;
+        for ( const std::string& string : q.hit_strings )
+            found += to_enum< EnumType >( string ).has_value();
+        return found;
+    };
+
+    BENCHMARK( name + " to_enum string miss" )
+    {
+        size_t found = 0;
+        for ( const std::string& string : q.miss_strings )
+            found += to_enum< EnumType >( string ).has_value();
+        return found;
+    };
+
+    BENCHMARK( name + " to_enum string hit (unordered_map)" )
+    {
+        size_t found = 0;
+        for ( const std::string& string : q.hit_strings )
+            found += q.map.contains( string );
+        return found;
+    };
+
+    BENCHMARK( name + " to_enum string miss (unordered_map)" )
+    {
+        size_t found = 0;
+        for ( const std::string& string : q.miss_strings )
+            found += q.map.contains( string );
+        return found;
+    };
+
+    BENCHMARK( name + " to_enum int hit" )
+    {
+        size_t found = 0;
+        for ( int value : q.hit_ints )
+            found += to_enum< EnumType >( value ).has_value();
+        return found;
+    };
+
+    BENCHMARK( name + " to_enum int miss" )
+    {
+        size_t found = 0;
+        for ( int value : q.miss_ints )
+            found += to_enum< EnumType >( value ).has_value();
+        return found;
+    };
+
+    BENCHMARK( name + " is_valid" )
+    {
+        size_t valid = 0;
+        for ( int value : q.hit_ints )
+            valid += is_valid< EnumType >( value );
+        return valid;
+    };
+
+    BENCHMARK( name + " is_valid (switch)" )
+    {
+        size_t valid = 0;
+        for ( int value : q.hit_ints )
+            valid += switch_is_valid( std::type_identity< EnumType > {}, value );
+        return valid;
+    };
+
+    BENCHMARK( name + " fmt::format" )
+    {
+        size_t size = 0;
+        for ( EnumType value : q.values )
+            size += fmt::format( "{}", value ).size();
+        return size;
+    };
+
+    BENCHMARK( name + " fmt::format (switch)" )
+    {
+        size_t size = 0;
+        for ( EnumType value : q.values )
+            size += fmt::format( "{}", switch_to_string( value ) ).size();
+        return size;
+    };
+
+#ifdef __cpp_lib_format
+    BENCHMARK( name + " std::format" )
+    {
+        size_t size = 0;
+        for ( EnumType value : q.values )
+            size += std::format( "{}", value ).size();
+        return size;
+    };
+#endif
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST_CASE( "ordinal enums", "[!benchmark]" )
+{
+    run_benchmarks< ordinal_4 >( "ordinal 4" );
+    run_benchmarks< ordinal_16 >( "ordinal 16" );
+    run_benchmarks< ordinal_128 >( "ordinal 128" );
+    run_benchmarks< ordinal_1024 >( "ordinal 1024" );
+}
+
+TEST_CASE( "sparse enums", "[!benchmark]" )
+{
+    run_benchmarks< sparse_4 >( "sparse 4" );
+    run_benchmarks< sparse_16 >( "sparse 16" );
+    run_benchmarks< sparse_128 >( "sparse 128" );
+    run_benchmarks< sparse_1024 >( "sparse 1024" );
+}
+
+TEST_CASE( "string compare", "[!benchmark]" )
+{
+    const queries< ordinal_128 >      word_keys;
+    const queries< string_views_128 > string_views;
+
+    BENCHMARK( "to_enum string hit (word keys)" )
+    {
+        size_t found = 0;
+        for ( const std::string& string : word_keys.hit_strings )
+            found += to_enum< ordinal_128 >( string ).has_value();
+        return found;
+    };
+
+    BENCHMARK( "to_enum string hit (string_views)" )
+    {
+        size_t found = 0;
+        for ( const std::string& string : string_views.hit_strings )
+            found += to_enum< string_views_128 >( string ).has_value();
+        return found;
+    };
+
+    BENCHMARK( "to_enum string miss (word keys)" )
+    {
+        size_t found = 0;
+        for ( const std::string& string : word_keys.miss_strings )
+            found += to_enum< ordinal_128 >( string ).has_value();
+        return found;
+    };
+
+    BENCHMARK( "to_enum string miss (string_views)" )
+    {
+        size_t found = 0;
+        for ( const std::string& string : string_views.miss_strings )
+            found += to_enum< string_views_128 >( string ).has_value();
+        return found;
+    };
+}
@@ -0,0 +1,71 @@
+########################################################################################################################
+# nova_enums_generate(TARGET <target> OUTPUT <header> ENUMS <types>... REGISTRATIONS <headers>...
+#                     [INCLUDES <headers>...])
+#
+# generates `OUTPUT` (relative to the current binary directory, which is added to the include directories of `TARGET`)
+# with the registrations of `ENUMS`. the lookup tables are sorted and hashed by a generator program at build time, so
+# translation units which include `OUTPUT` don't construct them during constant evaluation.
+#
+# REGISTRATIONS: headers with the `NOVA_ENUMS_REGISTER` of the enums. they are only compiled into the generator and
+#                must not be included together with `OUTPUT`
+# INCLUDES:      headers which define the enums (and specialize `string_lookup_strategy` etc.), included by `OUTPUT`
+#                via paths relative to `OUTPUT`
+#
+# the generator is compiled with the include directories, definitions, options and features of `TARGET`, including the
+# usage requirements of the libraries it links, so that the headers are seen as in the translation units of `TARGET`
+
+function(nova_enums_generate)
+    cmake_parse_arguments(PARSE_ARGV 0 ARG "" "TARGET;OUTPUT" "ENUMS;REGISTRATIONS;INCLUDES")
+
+    if (NOT ARG_TARGET OR NOT ARG_OUTPUT OR NOT ARG_ENUMS OR NOT ARG_REGISTRATIONS)
+        message(FATAL_ERROR "nova_enums_generate: TARGET, OUTPUT, ENUMS and REGISTRATIONS are required")
+    endif()
+
+    set(NOVA_ENUMS_TARGET ${ARG_TARGET})
+    list(JOIN ARG_ENUMS ", " NOVA_ENUMS_TYPES)
+
+    set(NOVA_ENUMS_REGISTRATION_INCLUDES)
+    foreach(header IN LISTS ARG_REGISTRATIONS)
+        cmake_path(ABSOLUTE_PATH header BASE_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR})
+        string(APPEND NOVA_ENUMS_REGISTRATION_INCLUDES "#include \"${header}\"\n")
+    endforeach()
+
+    cmake_path(ABSOLUTE_PATH ARG_OUTPUT BASE_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR} OUTPUT_VARIABLE output)
+    cmake_path(GET output PARENT_PATH output_directory)
+
+    # `#include "..."` is resolved relative to the including file first, so the generated header contains no absolute
+    # paths
+    set(NOVA_ENUMS_INCLUDES)
+    foreach(header IN LISTS ARG_INCLUDES)
+        cmake_path(ABSOLUTE_PATH header BASE_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR})
+        cmake_path(RELATIVE_PATH header BASE_DIRECTORY ${output_directory})
+        list(APPEND NOVA_ENUMS_INCLUDES "\"${header}\"")
+    endforeach()
+    list(JOIN NOVA_ENUMS_INCLUDES ", " NOVA_ENUMS_INCLUDES)
+
+    set(generator ${ARG_TARGET}_nova_enums_generator)
+    set(generator_source ${CMAKE_CURRENT_BINARY_DIR}/${generator}.cpp)
+    configure_file(${CMAKE_CURRENT_FUNCTION_LIST_DIR}/enums_generator.cpp.in ${generator_source} @ONLY)
+
+    # the registrations are compiled like the target. `$<TARGET_PROPERTY>` of these properties is evaluated
+    # transitively, i.e. it includes the usage requirements of the libraries that the target links
+    add_executable(${generator} ${generator_source})
+    target_link_libraries(${generator} PRIVATE nova::enums)
+    target_include_directories(${generator} PRIVATE $<TARGET_PROPERTY:${ARG_TARGET},INCLUDE_DIRECTORIES>)
+    target_compile_definitions(${generator} PRIVATE $<TARGET_PROPERTY:${ARG_TARGET},COMPILE_DEFINITIONS>)
+    target_compile_options(${generator} PRIVATE $<TARGET_PROPERTY:${ARG_TARGET},COMPILE_OPTIONS>)
+    target_compile_features(${generator} PRIVATE $<TARGET_PROPERTY:${ARG_TARGET},COMPILE_FEATURES>)
+    set_target_properties(${generator} PROPERTIES UNITY_BUILD OFF)
+
+    add_custom_command(
+        OUTPUT ${output}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${output_directory}
+        COMMAND ${generator} ${output}
+        DEPENDS ${generator}
+        COMMENT "Generating enum registrations ${ARG_OUTPUT}"
+        VERBATIM
+    )
+
+    target_sources(${ARG_TARGET} PRIVATE ${output})
+    target_include_directories(${ARG_TARGET} PRIVATE ${CMAKE_CURRENT_BINARY_DIR})
+endfunction()
@@ -0,0 +1,124 @@
+#pragma once
+
+// Copyright (c) 2023 Tim Blechmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// As a non-binding request, please use this code responsibly and ethically.
+
+
+#include <nova/enums/enums.hpp>
+
+#include <array>
+#include <initializer_list>
+#include <ranges>
+#include <utility>
+
+namespace nova::enums {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// map with a slot for every value of a registered enum. the slots are stored contiguously in the order of
+// `all_enum_values` and addressed via `index_of`, so sparse enums don't need a hash table or tree
+template < typename EnumType, typename Value >
+    requires( is_registered_enum_v< EnumType > )
+struct enum_map
+{
+    static_assert( impl::has_distinct_values< EnumType >, "enum_map needs an enum without aliased values" );
+
+    using key_type       = EnumType;
+    using mapped_type    = Value;
+    using storage        = std::array< Value, number_of_elements< EnumType > >;
+    using iterator       = typename storage::iterator;
+    using const_iterator = typename storage::const_iterator;
+
+    constexpr enum_map() = default;
+
+    constexpr enum_map( std::initializer_list< std::pair< EnumType, Value > > init )
+    {
+        for ( const auto& [ key, value ] : init )
+            ( *this )[ key ] = value;
+    }
+
+    static constexpr size_t size()
+    {
+        return number_of_elements< EnumType >;
+    }
+
+    constexpr Value& operator[]( EnumType key )
+    {
+        return values[ index_of( key ) ];
+    }
+
+    constexpr const Value& operator[]( EnumType key ) const
+    {
+        return values[ index_of( key ) ];
+    }
+
+    constexpr void fill( const Value& value )
+    {
+        values.fill( value );
+    }
+
+    // iteration over the mapped values
+    constexpr iterator begin()
+    {
+        return values.begin();
+    }
+
+    constexpr iterator end()
+    {
+        return values.end();
+    }
+
+    constexpr const_iterator begin() const
+    {
+        return values.begin();
+    }
+
+    constexpr const_iterator end() const
+    {
+        return values.end();
+    }
+
+    // iteration over ( key, value ) pairs
+    constexpr auto items()
+    {
+        auto item = [ this ]( size_t index ) {
+            return std::pair< EnumType, Value& > { from_index< EnumType >( index ), values[ index ] };
+        };
+        return std::ranges::views::iota( size_t( 0 ), size() ) | std::ranges::views::transform( item );
+    }
+
+    constexpr auto items() const
+    {
+        auto item = [ this ]( size_t index ) {
+            return std::pair< EnumType, const Value& > { from_index< EnumType >( index ), values[ index ] };
+        };
+        return std::ranges::views::iota( size_t( 0 ), size() ) | std::ranges::views::transform( item );
+    }
+
+    constexpr bool operator==( const enum_map& ) const = default;
+
+    storage values {};
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+} // namespace nova::enums
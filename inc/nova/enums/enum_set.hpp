@@ -0,0 +1,216 @@
+#pragma once
+
+// Copyright (c) 2023 Tim Blechmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// As a non-binding request, please use this code responsibly and ethically.
+
+
+#include <nova/enums/enums.hpp>
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+
+namespace nova::enums {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// set of values of a registered enum, stored as bitset over `index_of`: sparse enums are packed densely and set
+// operations work on whole words
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+struct enum_set
+{
+    static_assert( impl::has_distinct_values< EnumType >, "enum_set needs an enum without aliased values" );
+
+    static constexpr size_t number_of_words = ( number_of_elements< EnumType > + 63 ) / 64;
+
+    using word_array = std::array< uint64_t, number_of_words >;
+
+    struct iterator
+    {
+        using value_type      = EnumType;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr EnumType operator*() const
+        {
+            return from_index< EnumType >( word * 64 + size_t( std::countr_zero( bits ) ) );
+        }
+
+        constexpr iterator& operator++()
+        {
+            bits &= bits - 1;
+            skip_empty_words();
+            return *this;
+        }
+
+        constexpr iterator operator++( int )
+        {
+            iterator ret = *this;
+            ++*this;
+            return ret;
+        }
+
+        constexpr bool operator==( std::default_sentinel_t ) const
+        {
+            return word == number_of_words;
+        }
+
+        constexpr bool operator==( const iterator& ) const = default;
+
+        constexpr void skip_empty_words()
+        {
+            while ( bits == 0 && ++word != number_of_words )
+                bits = ( *words )[ word ];
+        }
+
+        const word_array* words {};
+        size_t            word {};
+        uint64_t          bits {};
+    };
+
+    constexpr enum_set() = default;
+
+    constexpr enum_set( std::initializer_list< EnumType > values )
+    {
+        for ( EnumType value : values )
+            insert( value );
+    }
+
+    // set of all values
+    static constexpr enum_set all()
+    {
+        enum_set ret;
+        for ( size_t word = 0; word != number_of_words; ++word ) {
+            const size_t remaining = number_of_elements< EnumType > - word * 64;
+            ret.words[ word ]      = remaining >= 64 ? ~uint64_t( 0 ) : ( uint64_t( 1 ) << remaining ) - 1;
+        }
+        return ret;
+    }
+
+    static constexpr size_t max_size()
+    {
+        return number_of_elements< EnumType >;
+    }
+
+    constexpr void insert( EnumType value )
+    {
+        const size_t index = index_of( value );
+        words[ index / 64 ] |= uint64_t( 1 ) << ( index % 64 );
+    }
+
+    constexpr void erase( EnumType value )
+    {
+        const size_t index = index_of( value );
+        words[ index / 64 ] &= ~( uint64_t( 1 ) << ( index % 64 ) );
+    }
+
+    constexpr bool contains( EnumType value ) const
+    {
+        const size_t index = index_of( value );
+        return ( words[ index / 64 ] >> ( index % 64 ) ) & 1;
+    }
+
+    constexpr size_t size() const
+    {
+        size_t ret = 0;
+        for ( uint64_t word : words )
+            ret += size_t( std::popcount( word ) );
+        return ret;
+    }
+
+    constexpr bool empty() const
+    {
+        return *this == enum_set {};
+    }
+
+    constexpr void clear()
+    {
+        words = {};
+    }
+
+    // iteration in the order of `all_enum_values`
+    constexpr iterator begin() const
+    {
+        iterator ret { &words, 0, number_of_words ? words[ 0 ] : 0 };
+        if constexpr ( number_of_words != 0 )
+            ret.skip_empty_words();
+        return ret;
+    }
+
+    constexpr std::default_sentinel_t end() const
+    {
+        return {};
+    }
+
+    // union, intersection, difference
+    constexpr enum_set& operator|=( const enum_set& rhs )
+    {
+        for ( size_t word = 0; word != number_of_words; ++word )
+            words[ word ] |= rhs.words[ word ];
+        return *this;
+    }
+
+    constexpr enum_set& operator&=( const enum_set& rhs )
+    {
+        for ( size_t word = 0; word != number_of_words; ++word )
+            words[ word ] &= rhs.words[ word ];
+        return *this;
+    }
+
+    constexpr enum_set& operator-=( const enum_set& rhs )
+    {
+        for ( size_t word = 0; word != number_of_words; ++word )
+            words[ word ] &= ~rhs.words[ word ];
+        return *this;
+    }
+
+    friend constexpr enum_set operator|( enum_set lhs, const enum_set& rhs )
+    {
+        return lhs |= rhs;
+    }
+
+    friend constexpr enum_set operator&( enum_set lhs, const enum_set& rhs )
+    {
+        return lhs &= rhs;
+    }
+
+    friend constexpr enum_set operator-( enum_set lhs, const enum_set& rhs )
+    {
+        return lhs -= rhs;
+    }
+
+    // complement
+    constexpr enum_set operator~() const
+    {
+        return all() - *this;
+    }
+
+    constexpr bool operator==( const enum_set& ) const = default;
+
+    word_array words {};
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+} // namespace nova::enums
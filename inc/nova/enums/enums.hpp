@@ -25,13 +25,50 @@
 #include <boost/preprocessor.hpp>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <string>
 #include <string_view>
 #include <type_traits>
 #include <utility>
 #include <version>
 
+// per enum call / miss counters of `to_enum`, `is_valid` and `to_string`, see `instrumentation::snapshot`. needs to be
+// defined consistently in all translation units
+#ifndef NOVA_ENUMS_ENABLE_INSTRUMENTATION
+#    define NOVA_ENUMS_ENABLE_INSTRUMENTATION 0
+#endif
+
+// formatters print the numeric value of unregistered enums and of values which are not registered. otherwise only
+// registered enums are formattable and values need to be valid
+#ifndef NOVA_ENUMS_FORMAT_NUMERIC_FALLBACK
+#    define NOVA_ENUMS_FORMAT_NUMERIC_FALLBACK 0
+#endif
+
+// registered enums are added to a process-wide registry, which resolves type names at runtime, see
+// `registry::find_enum`. needs to be defined consistently in all translation units
+#ifndef NOVA_ENUMS_ENABLE_REGISTRY
+#    define NOVA_ENUMS_ENABLE_REGISTRY 0
+#endif
+
+#if NOVA_ENUMS_ENABLE_INSTRUMENTATION || NOVA_ENUMS_ENABLE_REGISTRY
+#    include <atomic>
+#    include <vector>
+#endif
+
+#if NOVA_ENUMS_ENABLE_REGISTRY
+#    include <memory>
+#    include <mutex>
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace nova::enums {
@@ -56,6 +93,98 @@ struct string_adapter
 
 //----------------------------------------------------------------------------------------------------------------------
 
+enum class string_lookup
+{
+    sorted_table, // binary search over the names
+    perfect_hash, // compile-time generated minimal perfect hash
+};
+
+// customization point: specialize before registering the enum to select how `to_enum` maps strings to enums
+template < typename EnumType >
+struct string_lookup_strategy : std::integral_constant< string_lookup, string_lookup::perfect_hash >
+{};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+enum class value_lookup
+{
+    sorted_table, // binary search over the values
+    eytzinger,    // values in breadth-first order of a binary search tree: branchless search, prefetchable
+};
+
+namespace impl {
+
+template < typename EnumType >
+constexpr value_lookup default_value_lookup();
+
+} // namespace impl
+
+// customization point: specialize before registering the enum to select how `is_valid` / `to_string` find values of
+// sparse enums. by default, enums with at least `eytzinger_threshold` enumerators use the eytzinger layout
+template < typename EnumType >
+struct value_lookup_strategy : std::integral_constant< value_lookup, impl::default_value_lookup< EnumType >() >
+{};
+
+inline constexpr size_t eytzinger_threshold = 64;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+enum class string_layout
+{
+    string_views, // `std::string_view` per name
+    packed,       // one NUL-terminated character blob plus small offset / length arrays
+};
+
+// customization point: specialize before registering the enum to select how names are stored
+template < typename EnumType >
+struct string_layout_strategy : std::integral_constant< string_layout, string_layout::string_views >
+{};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+enum class string_compare
+{
+    string_views, // names are compared as `std::string_view`
+    word_keys,    // names are compared as (up to two) big-endian integer words and their length, without `memcmp`
+};
+
+namespace impl {
+
+template < typename EnumType >
+constexpr string_compare default_string_compare();
+
+} // namespace impl
+
+// customization point: specialize before registering the enum to select how `to_enum` compares strings with the names.
+// by default, word keys are used for the `string_views` layout if no name is longer than 16 characters
+template < typename EnumType >
+struct string_compare_strategy : std::integral_constant< string_compare, impl::default_string_compare< EnumType >() >
+{};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// string matching policies for `to_enum( string, policy )`. names are folded character by character while comparing
+
+template < bool FoldCase, bool FoldSeparators >
+struct ascii_match_policy
+{
+    static constexpr char fold( char c )
+    {
+        if ( FoldCase && c >= 'A' && c <= 'Z' )
+            return char( c - 'A' + 'a' );
+        if ( FoldSeparators && c == '-' )
+            return '_';
+        return c;
+    }
+};
+
+using exact_match                 = ascii_match_policy< false, false >;
+using case_insensitive_match      = ascii_match_policy< true, false >;
+using separator_insensitive_match = ascii_match_policy< false, true >; // `_` and `-` are equivalent
+using normalized_match            = ascii_match_policy< true, true >;
+
+//----------------------------------------------------------------------------------------------------------------------
+
 namespace impl {
 
 template < typename EnumType >
@@ -69,6 +198,15 @@ template < typename EnumType >
     requires( std::is_enum_v< EnumType > )
 constexpr inline bool is_registered_enum_v = impl::is_registered_enum< EnumType >::value;
 
+namespace impl {
+
+template < typename EnumType >
+    requires( std::is_enum_v< EnumType > )
+struct is_flags_enum : std::false_type
+{};
+
+} // namespace impl
+
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -76,7 +214,7 @@ namespace impl {
 
 //----------------------------------------------------------------------------------------------------------------------
 
-[[noreturn]] void unreachable()
+[[noreturn]] inline void unreachable()
 {
 #ifdef __cpp_lib_unreachable
     std::unreachable();
@@ -95,14 +233,140 @@ constexpr bool is_ordinal_table( std::array< EnumType, Size > list )
     return std::ranges::equal( list, std::ranges::views::iota( size_t( 0 ), list.size() ), {}, to_underlying< EnumType > );
 }
 
+// number of integral values between the smallest and the largest value (inclusive)
+template < typename EnumType, size_t Size >
+    requires( std::is_enum_v< EnumType > )
+constexpr uintmax_t value_span( std::array< EnumType, Size > list )
+{
+    auto [ min, max ] = std::ranges::minmax( list, {}, to_underlying< EnumType > );
+    return uintmax_t( to_underlying( max ) ) - uintmax_t( to_underlying( min ) ) + 1;
+}
+
+enum class table_kind
+{
+    ordinal, // values 0 .. N-1
+    dense,   // values cover a small span: offset-indexed
+    sparse,  // values sorted by value: binary search
+};
+
+// no value is registered twice (i.e. under an alias). only meaningful for a `value_span` of at most `2 * Size`
+template < typename EnumType, size_t Size >
+    requires( std::is_enum_v< EnumType > )
+constexpr bool has_distinct_values_in_span( std::array< EnumType, Size > list )
+{
+    const auto min = to_underlying( std::ranges::min( list, {}, to_underlying< EnumType > ) );
+
+    std::array< bool, 2 * Size > occupied {};
+    for ( EnumType value : list ) {
+        const size_t offset = size_t( uintmax_t( to_underlying( value ) ) - uintmax_t( min ) );
+        if ( occupied[ offset ] )
+            return false;
+        occupied[ offset ] = true;
+    }
+    return true;
+}
+
+template < typename EnumType, size_t Size >
+    requires( std::is_enum_v< EnumType > )
+constexpr table_kind classify_table( std::array< EnumType, Size > list )
+{
+    if ( is_ordinal_table( list ) )
+        return table_kind::ordinal;
+
+    // no more than half of the span are gaps. dense tables have one slot per value, so aliases need a sparse table
+    const uintmax_t span = value_span( list );
+    if ( span != 0 && span <= 2 * uintmax_t( Size ) && has_distinct_values_in_span( list ) )
+        return table_kind::dense;
+    return table_kind::sparse;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename EnumType >
+constexpr auto registered_values();
+
 //----------------------------------------------------------------------------------------------------------------------
 
+// splitting of the stringized enumerator list `a, b, c` of NOVA_ENUMS_REGISTER. written as a single pass over the
+// characters, as the list of large enums has tens of kilobytes which are processed during constant evaluation
+
+constexpr bool is_list_whitespace( char c )
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+template < typename Function >
+constexpr void for_each_name( std::string_view list, Function&& function )
+{
+    const char* const end = list.data() + list.size();
+
+    for ( const char* it = list.data(); it != end; ) {
+        while ( it != end && is_list_whitespace( *it ) )
+            ++it;
+
+        const char* const begin = it;
+        while ( it != end && *it != ',' )
+            ++it;
+
+        const char* last = it;
+        while ( last != begin && is_list_whitespace( last[ -1 ] ) )
+            --last;
+
+        if ( last != begin ) // trailing comma
+            function( std::string_view { begin, size_t( last - begin ) } );
+
+        if ( it != end )
+            ++it;
+    }
+}
+
+constexpr size_t count_names( std::string_view list )
+{
+    size_t count = 0;
+    for_each_name( list, [ & ]( std::string_view ) {
+        count += 1;
+    } );
+    return count;
+}
+
+template < size_t Size >
+constexpr std::array< std::string_view, Size > split_names( std::string_view list )
+{
+    std::array< std::string_view, Size > names;
+    size_t                               index = 0;
+    for_each_name( list, [ & ]( std::string_view name ) {
+        names[ index++ ] = name;
+    } );
+    return names;
+}
+
+template < typename EnumType, size_t Size >
+constexpr std::array< std::pair< EnumType, std::string_view >, Size >
+make_associations( const std::array< EnumType, Size >& values, const std::array< std::string_view, Size >& names )
+{
+    std::array< std::pair< EnumType, std::string_view >, Size > associations;
+    for ( size_t index : std::ranges::views::iota( size_t( 0 ), Size ) )
+        associations[ index ] = std::pair { values[ index ], names[ index ] };
+    return associations;
+}
+
 template < typename EnumType >
-constexpr bool determine_ordinality();
+    requires( std::is_enum_v< EnumType > )
+inline constexpr table_kind kind_of_table = classify_table( registered_values< EnumType >() );
 
 template < typename EnumType >
     requires( std::is_enum_v< EnumType > )
-inline constexpr bool is_ordinal = determine_ordinality< EnumType >();
+inline constexpr bool is_ordinal = kind_of_table< EnumType > == table_kind::ordinal;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// `std::in_range` for all integral types, including `bool` and character types
+template < typename To, typename IntType >
+    requires( std::is_integral_v< IntType > )
+constexpr bool in_range( IntType i )
+{
+    return std::in_range< To >( +i );
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -114,329 +378,2796 @@ template < typename EnumType >
     requires( std::is_enum_v< EnumType > )
 inline constexpr size_t number_of_elements_v = number_of_elements< EnumType >::value;
 
+template < typename EnumType >
+constexpr value_lookup default_value_lookup()
+{
+    return number_of_elements_v< EnumType > >= eytzinger_threshold ? value_lookup::eytzinger
+                                                                    : value_lookup::sorted_table;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
-template < typename EnumType, typename StringType >
-    requires( std::is_enum_v< EnumType > )
-struct enum_lookup_table_common
+// smallest unsigned type that can represent `MaxValue`
+template < size_t MaxValue >
+using uint_least_for_t
+    = std::conditional_t< ( MaxValue <= UINT8_MAX ),
+                          uint8_t,
+                          std::conditional_t< ( MaxValue <= UINT16_MAX ),
+                                              uint16_t,
+                                              std::conditional_t< ( MaxValue <= UINT32_MAX ), uint32_t, uint64_t > > >;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename Policy >
+concept match_policy = requires( char c ) {
+    { Policy::fold( c ) } -> std::same_as< char >;
+};
+
+// folded characters are ordered as `unsigned char`, like `std::char_traits< char >::compare`
+template < match_policy Policy >
+constexpr uint8_t folded_byte( char c )
 {
-    static constexpr size_t number_of_elements = number_of_elements_v< EnumType >;
+    return uint8_t( Policy::fold( c ) );
+}
 
-    using association       = std::pair< EnumType, StringType >;
-    using enum_lookup_table = std::array< std::pair< StringType, EnumType >, number_of_elements >;
+template < match_policy Policy >
+constexpr bool folded_equal( std::string_view lhs, std::string_view rhs )
+{
+    return std::ranges::equal( lhs, rhs, {}, Policy::fold, Policy::fold );
+}
 
-    constexpr explicit enum_lookup_table_common( std::array< association, number_of_elements > associations )
-    {
-        std::ranges::sort( associations, []( const association& lhs, const association& rhs ) {
-            return lhs.second < rhs.second;
-        } );
+template < match_policy Policy >
+constexpr bool folded_less( std::string_view lhs, std::string_view rhs )
+{
+    return std::ranges::lexicographical_compare( lhs, rhs, {}, folded_byte< Policy >, folded_byte< Policy > );
+}
 
-        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
-            string_to_enum_table[ index ] = std::pair {
-                associations[ index ].second,
-                associations[ index ].first,
-            };
-    }
+//----------------------------------------------------------------------------------------------------------------------
 
-    explicit enum_lookup_table_common( const enum_lookup_table_common< EnumType, std::string_view >& other )
-    {
-        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
-            string_to_enum_table[ index ] = std::pair {
-                nova::enums::string_adapter< StringType >()( other.string_to_enum_table[ index ].first ),
-                other.string_to_enum_table[ index ].second,
-            };
+// sorting during constant evaluation: `std::ranges::sort`, `std::string_view` comparisons and even `std::array`
+// element accesses are expensive to constant-evaluate, which dominates the compile time of enums with thousands of
+// enumerators. therefore the hot loops below work on raw pointers
 
-        std::ranges::sort( string_to_enum_table, std::less<> {}, []( const std::pair< StringType, EnumType >& value ) {
-            return value.first;
-        } );
+// bottom-up merge sort
+template < typename T, size_t Size, typename Less >
+constexpr void merge_sort( std::array< T, Size >& elements, Less&& less )
+{
+    if ( std::ranges::is_sorted( elements, less ) ) // e.g. enumerators declared in value order
+        return;
+
+    std::array< T, Size > buffer {};
+
+    T* source      = elements.data();
+    T* destination = buffer.data();
+    for ( size_t width = 1; width < Size; width *= 2 ) {
+        for ( size_t low = 0; low < Size; low += 2 * width ) {
+            const size_t middle = std::min( low + width, Size );
+            const size_t high   = std::min( low + 2 * width, Size );
+
+            size_t left = low, right = middle, out = low;
+            while ( left != middle && right != high )
+                destination[ out++ ] = less( source[ right ], source[ left ] ) ? source[ right++ ] : source[ left++ ];
+            while ( left != middle )
+                destination[ out++ ] = source[ left++ ];
+            while ( right != high )
+                destination[ out++ ] = source[ right++ ];
+        }
+        std::swap( source, destination );
     }
 
-    constexpr std::optional< EnumType > to_enum( const StringType& sv ) const
-    {
-        auto found = std::ranges::lower_bound( string_to_enum_table,
-                                               sv,
-                                               {},
-                                               []( const std::pair< StringType, EnumType >& element ) {
-            return element.first;
-        } );
+    if ( source != elements.data() )
+        elements = buffer;
+}
 
-        if ( found == string_to_enum_table.end() )
-            return std::nullopt;
+// first 8 (folded) characters as big-endian integer: orders like the strings, unless both prefixes are equal
+template < match_policy Policy >
+constexpr uint64_t prefix_key( std::string_view sv )
+{
+    const char* const data = sv.data();
 
-        if ( found->first == sv )
-            return found->second;
-        else
-            return std::nullopt;
+    uint64_t key = 0;
+    for ( size_t index = 0; index != sizeof( uint64_t ); ++index )
+        key = ( key << 8 ) | ( index < sv.size() ? folded_byte< Policy >( data[ index ] ) : 0 );
+    return key;
+}
+
+// permutation which sorts `names` under `Policy`. the keys skip the prefix that all names have in common
+template < size_t Size, match_policy Policy = exact_match, typename Names >
+constexpr std::array< size_t, Size > sorted_order( const Names& names )
+{
+    std::array< std::string_view, Size > views {};
+    for ( size_t index = 0; index != Size; ++index )
+        views[ index ] = names[ index ];
+    const std::string_view* const view = views.data();
+
+    size_t common_prefix = Size != 0 ? view[ 0 ].size() : 0;
+    for ( size_t index = 1; index < Size; ++index ) {
+        const char* const first = view[ 0 ].data();
+        const char* const name  = view[ index ].data();
+
+        const size_t length = std::min( common_prefix, view[ index ].size() );
+        for ( common_prefix = 0; common_prefix != length; ++common_prefix )
+            if ( Policy::fold( name[ common_prefix ] ) != Policy::fold( first[ common_prefix ] ) )
+                break;
     }
 
-    constexpr std::array< StringType, number_of_elements > all_enum_strings() const
-    {
-        std::array< StringType, number_of_elements > ret;
-        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
-            ret[ index ] = string_to_enum_table[ index ].first;
-        return ret;
+    std::array< uint64_t, Size > keys {};
+    std::array< size_t, Size >   order {};
+    for ( size_t index = 0; index != Size; ++index ) {
+        keys[ index ]  = prefix_key< Policy >( view[ index ].substr( common_prefix ) );
+        order[ index ] = index;
     }
 
-    enum_lookup_table string_to_enum_table {};
-};
+    const uint64_t* const key = keys.data();
+    merge_sort( order, [ & ]( size_t lhs, size_t rhs ) {
+        if ( key[ lhs ] != key[ rhs ] )
+            return key[ lhs ] < key[ rhs ];
+        return folded_less< Policy >( view[ lhs ], view[ rhs ] );
+    } );
+    return order;
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 
-template < typename EnumType, typename StringType >
-    requires( std::is_enum_v< EnumType > )
-struct ordinal_enum_lookup_table : enum_lookup_table_common< EnumType, StringType >
+// fnv-1a
+template < match_policy Policy = exact_match >
+constexpr uint64_t hash_string( std::string_view sv )
 {
-    using common_table = enum_lookup_table_common< EnumType, StringType >;
-    using association  = typename common_table::association;
-    using common_table::number_of_elements;
+    uint64_t hash = 0xcbf29ce484222325;
+    for ( char c : sv ) {
+        hash ^= folded_byte< Policy >( c );
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
 
-    using string_lookup_table = std::array< StringType, number_of_elements >;
+// splitmix64 finalizer
+constexpr uint64_t mix_hash( uint64_t hash, uint64_t seed )
+{
+    hash += seed * 0x9e3779b97f4a7c15;
+    hash = ( hash ^ ( hash >> 30 ) ) * 0xbf58476d1ce4e5b9;
+    hash = ( hash ^ ( hash >> 27 ) ) * 0x94d049bb133111eb;
+    return hash ^ ( hash >> 31 );
+}
 
-    constexpr explicit ordinal_enum_lookup_table( std::array< association, number_of_elements > associations ) :
-        common_table {
-            associations,
+// maps a hash to [0, range) without division
+constexpr size_t reduce_hash( uint64_t hash, size_t range )
+{
+    return size_t( ( ( hash >> 32 ) * uint64_t( range ) ) >> 32 );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// hash-and-displace minimal perfect hash: every key is hashed into a bucket. buckets with more than one key store a
+// seed which spreads their keys to free slots, buckets with a single key store their slot directly (as negative
+// number). lookups therefore need one hash, two table reads and one string comparison
+template < size_t Size, match_policy Policy = exact_match >
+struct perfect_hash_index
+{
+    using slot_type = uint_least_for_t< Size >;
+
+    static constexpr int32_t max_seed = 1 << 24;
+
+    constexpr perfect_hash_index() = default;
+
+    // precomputed by `nova_enums_generate`
+    constexpr perfect_hash_index( const std::array< int32_t, Size >&   displacements,
+                                  const std::array< slot_type, Size >& slots ) :
+        displacements {
+            displacements,
+        },
+        slots {
+            slots,
         }
+    {}
+
+    template < typename Keys >
+    constexpr explicit perfect_hash_index( const Keys& keys )
     {
-        assert( std::ranges::is_sorted( associations, []( const association& lhs, const association& rhs ) {
-            return lhs.first < rhs.first;
-        } ) );
+        std::array< uint64_t, Size > hashes {};
+        std::array< size_t, Size >   buckets {};
+        std::array< size_t, Size >   bucket_sizes {};
+
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), Size ) ) {
+            hashes[ index ]  = hash_key( keys[ index ] );
+            buckets[ index ] = bucket_of( hashes[ index ] );
+            bucket_sizes[ buckets[ index ] ] += 1;
+        }
 
-        auto strings_only = std::ranges::views::transform( associations, []( const association& value ) {
-            return value.second;
-        } );
+        // place large buckets first, while the table is still empty. counting sort: keys grouped by bucket, buckets
+        // ordered by decreasing size
+        std::array< size_t, Size + 1 > size_begin {};
+        for ( size_t bucket_size : bucket_sizes )
+            size_begin[ bucket_size ] += bucket_size;
+        for ( size_t bucket_size = Size, position = 0; bucket_size != 0; --bucket_size )
+            position += std::exchange( size_begin[ bucket_size ], position );
+
+        std::array< size_t, Size > bucket_begin {};
+        for ( size_t bucket : std::ranges::views::iota( size_t( 0 ), Size ) ) {
+            bucket_begin[ bucket ] = size_begin[ bucket_sizes[ bucket ] ];
+            size_begin[ bucket_sizes[ bucket ] ] += bucket_sizes[ bucket ];
+        }
 
-        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
-            string_table[ index ] = strings_only[ index ];
+        std::array< size_t, Size > order {};
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), Size ) )
+            order[ bucket_begin[ buckets[ index ] ]++ ] = index;
+
+        std::array< bool, Size >   occupied {};
+        std::array< size_t, Size > candidate_slots {};
+        size_t                     next_free_slot = 0;
+
+        for ( size_t begin = 0; begin != Size; ) {
+            const size_t bucket      = buckets[ order[ begin ] ];
+            const size_t bucket_size = bucket_sizes[ bucket ];
+            const size_t end         = begin + bucket_size;
+
+            if ( bucket_size == 1 ) {
+                while ( occupied[ next_free_slot ] )
+                    ++next_free_slot;
+
+                occupied[ next_free_slot ] = true;
+                slots[ next_free_slot ]    = slot_type( order[ begin ] );
+                displacements[ bucket ]    = -int32_t( next_free_slot ) - 1;
+                begin                      = end;
+                continue;
+            }
+
+            // hot loop of the construction: raw pointers are cheaper to constant-evaluate
+            const size_t* const member_keys = order.data() + begin;
+            const uint64_t*     key_hashes  = hashes.data();
+            const bool*         is_occupied = occupied.data();
+            size_t*             candidates  = candidate_slots.data();
+
+            for ( int32_t seed = 1;; ++seed ) {
+                if ( seed == max_seed )
+                    construction_failed(); // duplicate names?
+
+                bool collision = false;
+                for ( size_t member = 0; member != bucket_size && !collision; ++member ) {
+                    const size_t slot = slot_of( key_hashes[ member_keys[ member ] ], seed );
+
+                    collision = is_occupied[ slot ];
+                    for ( size_t previous = 0; previous != member && !collision; ++previous )
+                        collision = candidates[ previous ] == slot;
+
+                    candidates[ member ] = slot;
+                }
+
+                if ( collision )
+                    continue;
+
+                for ( size_t member = begin; member != end; ++member ) {
+                    occupied[ candidate_slots[ member - begin ] ] = true;
+                    slots[ candidate_slots[ member - begin ] ]    = slot_type( order[ member ] );
+                }
+                displacements[ bucket ] = seed;
+                break;
+            }
+
+            begin = end;
+        }
     }
 
-    explicit ordinal_enum_lookup_table( const ordinal_enum_lookup_table< EnumType, std::string_view >& other ) :
-        common_table {
-            other,
-        }
+    // returns the only index that may contain `sv`
+    constexpr size_t find( std::string_view sv ) const
     {
-        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
-            string_table[ index ] = nova::enums::string_adapter< StringType >()( other.string_table[ index ] );
+        return find_hash( hash_key( sv ) );
     }
 
-    template < typename IntType >
-        requires( std::is_integral_v< IntType > )
-    constexpr bool is_valid( IntType i ) const
+    // integer keys, e.g. enum values
+    template < std::integral Key >
+    constexpr size_t find( Key key ) const
     {
-        return i >= 0 && i < number_of_elements;
+        return find_hash( hash_key( key ) );
     }
 
-    constexpr const StringType& to_string( EnumType e ) const
+    std::array< int32_t, Size >   displacements {};
+    std::array< slot_type, Size > slots {};
+
+private:
+    // integers are only scrambled by `mix_hash`
+    static constexpr uint64_t hash_key( std::string_view sv )
     {
-        assert( is_valid( to_underlying( e ) ) );
-        return string_table[ to_underlying( e ) ];
+        return hash_string< Policy >( sv );
     }
 
-    constexpr std::array< EnumType, number_of_elements > all_enums() const
+    template < std::integral Key >
+    static constexpr uint64_t hash_key( Key key )
     {
-        std::array< EnumType, number_of_elements > ret;
-        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
-            ret[ index ] = EnumType( index );
-        return ret;
+        return uint64_t( key );
     }
 
-    string_lookup_table string_table {};
-};
-
-//----------------------------------------------------------------------------------------------------------------------
+    constexpr size_t find_hash( uint64_t hash ) const
+    {
+        const int32_t displacement = displacements[ bucket_of( hash ) ];
 
-template < typename EnumType, typename StringType >
-    requires( std::is_enum_v< EnumType > )
-struct enum_lookup_table : enum_lookup_table_common< EnumType, StringType >
-{
-    using common_table = enum_lookup_table_common< EnumType, StringType >;
-    using association  = typename common_table::association;
-    using common_table::number_of_elements;
+        if ( displacement < 0 )
+            return slots[ size_t( -( displacement + 1 ) ) ];
+        return slots[ slot_of( hash, displacement ) ];
+    }
 
-    using string_lookup_table = std::array< std::pair< EnumType, StringType >, number_of_elements >;
+    static constexpr size_t bucket_of( uint64_t hash )
+    {
+        return reduce_hash( mix_hash( hash, 0 ), Size );
+    }
 
-    constexpr enum_lookup_table( const std::array< association, number_of_elements >& associations ) :
+    static constexpr size_t slot_of( uint64_t hash, int32_t seed )
+    {
+        return reduce_hash( mix_hash( hash, uint64_t( seed ) ), Size );
+    }
+
+    static void construction_failed()
+    {
+        // not constexpr: reaching this during constant evaluation is a compile error
+        unreachable();
+    }
+};
+
+struct no_hash_index
+{};
+
+// sorted keys, stored in breadth-first order of the implicit binary search tree (1-based: the children of node `k` are
+// `2k` and `2k + 1`). the top levels of the tree share a few cache lines, the search has no data-dependent branches
+// and the nodes of later levels can be prefetched. `ranks` maps nodes to positions in the sorted order
+template < typename Key, size_t Size >
+struct eytzinger_index
+{
+    using rank_type = uint_least_for_t< Size >;
+
+    static constexpr size_t not_found = Size;
+
+    constexpr eytzinger_index() = default;
+
+    // `sorted_keys[ index ]` for index in [0, Size), in ascending order
+    template < typename SortedKeys >
+    constexpr explicit eytzinger_index( const SortedKeys& sorted_keys )
+    {
+        size_t rank = 0;
+        fill( 1, rank, sorted_keys );
+    }
+
+    // position of `key` in the sorted order, or `not_found`
+    constexpr size_t find( Key key ) const
+    {
+        size_t node = 1;
+        while ( node <= Size ) {
+            if ( !std::is_constant_evaluated() )
+                prefetch( node * prefetch_distance );
+            node = 2 * node + size_t( keys[ node ] < key );
+        }
+
+        // the path ends in a leaf: the last left turn is the smallest key that is not less than `key`
+        node >>= std::countr_one( node ) + 1;
+        if ( node == 0 || keys[ node ] != key )
+            return not_found;
+        return ranks[ node ];
+    }
+
+    std::array< Key, Size + 1 >       keys {}; // index 0 is unused
+    std::array< rank_type, Size + 1 > ranks {};
+
+private:
+    // descendants four levels down share a cache line
+    static constexpr size_t prefetch_distance = std::max( size_t( 64 / sizeof( Key ) ), size_t( 1 ) );
+
+    // in-order traversal of the tree visits the nodes in sorted order
+    template < typename SortedKeys >
+    constexpr void fill( size_t node, size_t& rank, const SortedKeys& sorted_keys )
+    {
+        if ( node > Size )
+            return;
+        fill( 2 * node, rank, sorted_keys );
+        keys[ node ]  = sorted_keys[ rank ];
+        ranks[ node ] = rank_type( rank );
+        rank += 1;
+        fill( 2 * node + 1, rank, sorted_keys );
+    }
+
+    void prefetch( [[maybe_unused]] size_t node ) const
+    {
+#if defined( __GNUC__ ) || defined( __clang__ )
+        if ( node <= Size )
+            __builtin_prefetch( keys.data() + node );
+#endif
+    }
+};
+
+struct no_value_index
+{};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// tag of the constructors which take tables that `nova_enums_generate` has sorted and hashed already
+struct presorted_t
+{};
+
+inline constexpr presorted_t presorted {};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename EnumType, typename StringType >
+    requires( std::is_enum_v< EnumType > )
+struct enum_lookup_table_common
+{
+    static constexpr size_t number_of_elements = number_of_elements_v< EnumType >;
+
+    static constexpr bool uses_perfect_hash = std::is_same_v< StringType, std::string_view >
+                                           && string_lookup_strategy< EnumType >::value == string_lookup::perfect_hash;
+
+    using association       = std::pair< EnumType, StringType >;
+    using enum_lookup_table = std::array< std::pair< StringType, EnumType >, number_of_elements >;
+    using hash_index
+        = std::conditional_t< uses_perfect_hash, perfect_hash_index< number_of_elements >, no_hash_index >;
+
+    constexpr explicit enum_lookup_table_common( const std::array< association, number_of_elements >& associations )
+    {
+        const auto order = sorted_order< number_of_elements >( std::ranges::views::values( associations ) );
+
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            string_to_enum_table[ index ] = std::pair {
+                associations[ order[ index ] ].second,
+                associations[ order[ index ] ].first,
+            };
+
+        if constexpr ( uses_perfect_hash )
+            string_hash_index = hash_index { std::ranges::views::keys( string_to_enum_table ) };
+    }
+
+    constexpr enum_lookup_table_common( presorted_t,
+                                        const enum_lookup_table&                         sorted_names,
+                                        const perfect_hash_index< number_of_elements >& names_hash ) :
+        string_to_enum_table {
+            sorted_names,
+        }
+    {
+        if constexpr ( uses_perfect_hash )
+            string_hash_index = names_hash;
+    }
+
+    template < typename Adapter = string_adapter< StringType > >
+    constexpr explicit enum_lookup_table_common( const enum_lookup_table_common< EnumType, std::string_view >& other,
+                                                 Adapter adapter = {} )
+    {
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            string_to_enum_table[ index ] = std::pair {
+                adapter( other.string_to_enum_table[ index ].first ),
+                other.string_to_enum_table[ index ].second,
+            };
+
+        // usually still sorted, unless `StringType` orders differently than `std::string_view`
+        merge_sort( string_to_enum_table,
+                    []( const std::pair< StringType, EnumType >& lhs, const std::pair< StringType, EnumType >& rhs ) {
+            return lhs.first < rhs.first;
+        } );
+    }
+
+    constexpr std::optional< EnumType > to_enum( const StringType& sv ) const
+    {
+        if constexpr ( uses_perfect_hash ) {
+            const auto& candidate = string_to_enum_table[ string_hash_index.find( sv ) ];
+            if ( candidate.first == sv )
+                return candidate.second;
+            return std::nullopt;
+        }
+
+        auto found = std::ranges::lower_bound( string_to_enum_table,
+                                               sv,
+                                               {},
+                                               []( const std::pair< StringType, EnumType >& element ) {
+            return element.first;
+        } );
+
+        if ( found == string_to_enum_table.end() )
+            return std::nullopt;
+
+        if ( found->first == sv )
+            return found->second;
+        else
+            return std::nullopt;
+    }
+
+    // converts `count` strings: `get( index )` returns a string, `put( index, std::optional< EnumType > )` consumes
+    // the result. hash probes are issued in groups, so that the independent loads of neighbouring lookups overlap
+    template < typename Get, typename Put >
+    constexpr size_t to_enum_bulk( size_t count, Get&& get, Put&& put ) const
+    {
+        size_t found = 0;
+
+        if constexpr ( uses_perfect_hash ) {
+            constexpr size_t                 group_size = 8;
+            std::array< size_t, group_size > candidates {};
+
+            for ( size_t group = 0; group < count; group += group_size ) {
+                const size_t elements = std::min( group_size, count - group );
+
+                for ( size_t element = 0; element != elements; ++element )
+                    candidates[ element ] = string_hash_index.find( get( group + element ) );
+
+                for ( size_t element = 0; element != elements; ++element ) {
+                    const auto& candidate = string_to_enum_table[ candidates[ element ] ];
+                    if ( candidate.first == get( group + element ) ) {
+                        put( group + element, std::optional { candidate.second } );
+                        found += 1;
+                    } else {
+                        put( group + element, std::optional< EnumType > {} );
+                    }
+                }
+            }
+        } else {
+            for ( size_t index = 0; index != count; ++index ) {
+                std::optional< EnumType > result = to_enum( get( index ) );
+                found += result.has_value();
+                put( index, result );
+            }
+        }
+
+        return found;
+    }
+
+    // longest name that is a prefix of `input`, with its length. narrows the range of names which share the characters
+    // read so far, so every input character is read once
+    constexpr std::optional< std::pair< EnumType, size_t > > parse_prefix( std::string_view input ) const
+    {
+        std::optional< std::pair< EnumType, size_t > > longest;
+
+        const auto* first = string_to_enum_table.data();
+        const auto* last  = first + number_of_elements;
+        for ( size_t depth = 0; first != last; ++depth ) {
+            // names are sorted, so a name which ends here is the first of the range
+            if ( first->first.size() == depth ) {
+                longest = std::pair { first->second, depth };
+                ++first;
+            }
+
+            if ( depth == input.size() )
+                break;
+
+            const uint8_t c       = uint8_t( input[ depth ] );
+            auto          char_at = [ depth ]( const std::pair< StringType, EnumType >& element ) {
+                return uint8_t( element.first[ depth ] );
+            };
+            first = std::ranges::lower_bound( first, last, c, {}, char_at );
+            last  = std::ranges::upper_bound( first, last, c, {}, char_at );
+        }
+        return longest;
+    }
+
+    constexpr std::array< StringType, number_of_elements > all_enum_strings() const
+    {
+        std::array< StringType, number_of_elements > ret;
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            ret[ index ] = string_to_enum_table[ index ].first;
+        return ret;
+    }
+
+    enum_lookup_table                string_to_enum_table {};
+    [[no_unique_address]] hash_index string_hash_index {};
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename EnumType, typename StringType >
+    requires( std::is_enum_v< EnumType > )
+struct ordinal_enum_lookup_table : enum_lookup_table_common< EnumType, StringType >
+{
+    using common_table = enum_lookup_table_common< EnumType, StringType >;
+    using association  = typename common_table::association;
+    using common_table::number_of_elements;
+
+    using string_lookup_table = std::array< StringType, number_of_elements >;
+
+    constexpr explicit ordinal_enum_lookup_table( const std::array< association, number_of_elements >& associations ) :
         common_table {
             associations,
         }
     {
-        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) ) {
-            string_table[ index ] = associations[ index ];
+        fill_string_table( associations );
+    }
+
+    // `associations` sorted by value
+    constexpr ordinal_enum_lookup_table( presorted_t,
+                                         const std::array< association, number_of_elements >& associations,
+                                         const typename common_table::enum_lookup_table&       sorted_names,
+                                         const perfect_hash_index< number_of_elements >&       names_hash ) :
+        common_table {
+            presorted,
+            sorted_names,
+            names_hash,
+        }
+    {
+        fill_string_table( associations );
+    }
+
+    template < typename Adapter = string_adapter< StringType > >
+    constexpr explicit ordinal_enum_lookup_table( const ordinal_enum_lookup_table< EnumType, std::string_view >& other,
+                                                  Adapter adapter = {} ) :
+        common_table {
+            other,
+            adapter,
         }
+    {
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            string_table[ index ] = adapter( other.string_table[ index ] );
+    }
+
+    template < typename IntType >
+        requires( std::is_integral_v< IntType > )
+    constexpr bool is_valid( IntType i ) const
+    {
+        return i >= 0 && i < number_of_elements;
+    }
+
+    constexpr const StringType& to_string( EnumType e ) const
+    {
+        assert( is_valid( to_underlying( e ) ) );
+        return string_table[ to_underlying( e ) ];
+    }
+
+    constexpr std::array< EnumType, number_of_elements > all_enums() const
+    {
+        std::array< EnumType, number_of_elements > ret;
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            ret[ index ] = EnumType( index );
+        return ret;
+    }
 
-        std::ranges::sort( string_table, []( const association& lhs, const association& rhs ) {
+    string_lookup_table string_table {};
+
+private:
+    constexpr void fill_string_table( const std::array< association, number_of_elements >& associations )
+    {
+        assert( std::ranges::is_sorted( associations, []( const association& lhs, const association& rhs ) {
             return lhs.first < rhs.first;
+        } ) );
+
+        auto strings_only = std::ranges::views::transform( associations, []( const association& value ) {
+            return value.second;
         } );
+
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            string_table[ index ] = strings_only[ index ];
+    }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename EnumType, typename StringType >
+    requires( std::is_enum_v< EnumType > )
+struct dense_enum_lookup_table : enum_lookup_table_common< EnumType, StringType >
+{
+    using common_table = enum_lookup_table_common< EnumType, StringType >;
+    using association  = typename common_table::association;
+    using common_table::number_of_elements;
+
+    using underlying_type = std::underlying_type_t< EnumType >;
+
+    static constexpr underlying_type min_value
+        = to_underlying( std::ranges::min( registered_values< EnumType >(), {}, to_underlying< EnumType > ) );
+    static constexpr size_t span            = size_t( value_span( registered_values< EnumType >() ) );
+    static constexpr size_t number_of_words = ( span + 63 ) / 64;
+
+    using string_lookup_table = std::array< StringType, span >;
+    using validity_bitmap     = std::array< uint64_t, number_of_words >;
+
+    constexpr explicit dense_enum_lookup_table( const std::array< association, number_of_elements >& associations ) :
+        common_table {
+            associations,
+        }
+    {
+        fill_string_table( associations );
+    }
+
+    constexpr dense_enum_lookup_table( presorted_t,
+                                       const std::array< association, number_of_elements >& associations,
+                                       const typename common_table::enum_lookup_table&       sorted_names,
+                                       const perfect_hash_index< number_of_elements >&       names_hash ) :
+        common_table {
+            presorted,
+            sorted_names,
+            names_hash,
+        }
+    {
+        fill_string_table( associations );
     }
 
-    constexpr enum_lookup_table( const enum_lookup_table< EnumType, std::string_view >& other ) :
+    template < typename Adapter = string_adapter< StringType > >
+    constexpr explicit dense_enum_lookup_table( const dense_enum_lookup_table< EnumType, std::string_view >& other,
+                                                Adapter adapter = {} ) :
         common_table {
             other,
+            adapter,
+        },
+        valid_bits {
+            other.valid_bits,
         }
     {
-        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
-            string_table[ index ] = std::pair {
-                other.string_table[ index ].first,
-                nova::enums::string_adapter< StringType >()( other.string_table[ index ].second ),
-            };
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), span ) )
+            if ( is_valid_offset( index ) )
+                string_table[ index ] = adapter( other.string_table[ index ] );
+    }
+
+    template < typename IntType >
+        requires( std::is_integral_v< IntType > )
+    constexpr bool is_valid( IntType i ) const
+    {
+        if ( !in_range< underlying_type >( i ) )
+            return false;
+
+        const size_t index = offset_of( underlying_type( i ) );
+        return index < span && is_valid_offset( index );
+    }
+
+    constexpr const StringType& to_string( EnumType e ) const
+    {
+        assert( is_valid( to_underlying( e ) ) );
+        return string_table[ offset_of( to_underlying( e ) ) ];
+    }
+
+    constexpr std::array< EnumType, number_of_elements > all_enums() const
+    {
+        std::array< EnumType, number_of_elements > ret;
+        size_t                                     element = 0;
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), span ) )
+            if ( is_valid_offset( index ) )
+                ret[ element++ ] = EnumType( uintmax_t( min_value ) + index );
+        return ret;
+    }
+
+    string_lookup_table string_table {};
+    validity_bitmap     valid_bits {};
+
+private:
+    constexpr void fill_string_table( const std::array< association, number_of_elements >& associations )
+    {
+        for ( const association& value : associations ) {
+            const size_t index      = offset_of( to_underlying( value.first ) );
+            string_table[ index ]   = value.second;
+            valid_bits[ index / 64 ] |= uint64_t( 1 ) << ( index % 64 );
+        }
+    }
+
+    static constexpr size_t offset_of( underlying_type value )
+    {
+        return size_t( uintmax_t( value ) - uintmax_t( min_value ) );
     }
 
-    template < typename IntType >
-        requires( std::is_integral_v< IntType > )
-    constexpr bool is_valid( IntType i ) const
-    {
-        auto found = std::ranges::lower_bound( string_table,
-                                               i,
-                                               std::less<>(),
-                                               []( const std::pair< EnumType, StringType >& element ) {
-            return IntType( element.first );
-        } );
-        if ( found == string_table.end() )
-            return false;
+    constexpr bool is_valid_offset( size_t index ) const
+    {
+        return ( valid_bits[ index / 64 ] >> ( index % 64 ) ) & 1;
+    }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename EnumType, typename StringType >
+    requires( std::is_enum_v< EnumType > )
+struct enum_lookup_table : enum_lookup_table_common< EnumType, StringType >
+{
+    using common_table = enum_lookup_table_common< EnumType, StringType >;
+    using association  = typename common_table::association;
+    using common_table::number_of_elements;
+
+    using string_lookup_table = std::array< std::pair< EnumType, StringType >, number_of_elements >;
+    using underlying_type     = std::underlying_type_t< EnumType >;
+
+    static constexpr bool uses_eytzinger = value_lookup_strategy< EnumType >::value == value_lookup::eytzinger;
+
+    using value_index = std::conditional_t< uses_eytzinger,
+                                            eytzinger_index< underlying_type, number_of_elements >,
+                                            no_value_index >;
+
+    constexpr enum_lookup_table( const std::array< association, number_of_elements >& associations ) :
+        common_table {
+            associations,
+        }
+    {
+        std::array< size_t, number_of_elements > order {};
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            order[ index ] = index;
+
+        merge_sort( order, [ & ]( size_t lhs, size_t rhs ) {
+            return associations[ lhs ].first < associations[ rhs ].first;
+        } );
+
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            string_table[ index ] = associations[ order[ index ] ];
+
+        build_value_index();
+    }
+
+    // `associations` sorted by value
+    constexpr enum_lookup_table( presorted_t,
+                                 const std::array< association, number_of_elements >& associations,
+                                 const typename common_table::enum_lookup_table&       sorted_names,
+                                 const perfect_hash_index< number_of_elements >&       names_hash ) :
+        common_table {
+            presorted,
+            sorted_names,
+            names_hash,
+        },
+        string_table {
+            associations,
+        }
+    {
+        build_value_index();
+    }
+
+    template < typename Adapter = string_adapter< StringType > >
+    constexpr enum_lookup_table( const enum_lookup_table< EnumType, std::string_view >& other, Adapter adapter = {} ) :
+        common_table {
+            other,
+            adapter,
+        },
+        sorted_value_index {
+            other.sorted_value_index,
+        }
+    {
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            string_table[ index ] = std::pair {
+                other.string_table[ index ].first,
+                adapter( other.string_table[ index ].second ),
+            };
+    }
+
+    template < typename IntType >
+        requires( std::is_integral_v< IntType > )
+    constexpr bool is_valid( IntType i ) const
+    {
+        if constexpr ( uses_eytzinger )
+            return in_range< underlying_type >( i )
+                && sorted_value_index.find( underlying_type( i ) ) != value_index::not_found;
+
+        // compared as `underlying_type`: the order of the values may change when they are converted to `IntType`
+        if ( !in_range< underlying_type >( i ) )
+            return false;
+
+        auto found = std::ranges::lower_bound( string_table,
+                                               underlying_type( i ),
+                                               std::less<>(),
+                                               []( const std::pair< EnumType, StringType >& element ) {
+            return to_underlying( element.first );
+        } );
+        if ( found == string_table.end() )
+            return false;
+
+        return to_underlying( found->first ) == underlying_type( i );
+    }
+
+    constexpr const StringType& to_string( EnumType e ) const
+    {
+        if constexpr ( uses_eytzinger ) {
+            const size_t rank = sorted_value_index.find( to_underlying( e ) );
+            assert( rank != value_index::not_found && "enum not found" );
+            return string_table[ rank ].second;
+        }
+
+        auto found = std::ranges::lower_bound( string_table,
+                                               e,
+                                               std::less<>(),
+                                               []( const std::pair< EnumType, StringType >& element ) {
+            return element.first;
+        } );
+
+        if ( found != string_table.end() && found->first == e )
+            return found->second;
+
+        assert( false && "enum not found" );
+        unreachable();
+        return string_table.front().second;
+    }
+
+    constexpr std::array< EnumType, number_of_elements > all_enums() const
+    {
+        std::array< EnumType, number_of_elements > ret;
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            ret[ index ] = string_table[ index ].first;
+        return ret;
+    }
+
+    string_lookup_table               string_table {};
+    [[no_unique_address]] value_index sorted_value_index {};
+
+private:
+    constexpr void build_value_index()
+    {
+        if constexpr ( uses_eytzinger )
+            sorted_value_index = value_index { std::ranges::views::transform(
+                string_table, []( const std::pair< EnumType, StringType >& element ) {
+                return to_underlying( element.first );
+            } ) };
+    }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename Enum, typename StringType >
+using lookup_table_t = std::conditional_t<
+    kind_of_table< Enum > == table_kind::ordinal,
+    ordinal_enum_lookup_table< Enum, StringType >,
+    std::conditional_t< kind_of_table< Enum > == table_kind::dense,
+                        dense_enum_lookup_table< Enum, StringType >,
+                        enum_lookup_table< Enum, StringType > > >;
+
+template < typename Enum >
+constexpr auto make_enum_table();
+
+// tables emitted by `nova_enums_generate`: no sorting or hashing during constant evaluation
+template < typename Enum,
+           size_t Size     = number_of_elements_v< Enum >,
+           typename Slot   = typename perfect_hash_index< Size >::slot_type >
+constexpr auto make_presorted_table( const std::array< std::pair< Enum, std::string_view >, Size >& values,
+                                     const std::array< std::pair< std::string_view, Enum >, Size >& names,
+                                     const std::array< int32_t, Size >&                             displacements,
+                                     const std::array< Slot, Size >&                                slots )
+{
+    return lookup_table_t< Enum, std::string_view >(
+        presorted, values, names, perfect_hash_index< Size > { displacements, slots } );
+}
+
+template < typename Enum, typename StringType >
+constexpr auto enum_table_for_string_type()
+{
+    if constexpr ( std::is_same_v< StringType, std::string_view > )
+        return make_enum_table< Enum >();
+    else
+        return lookup_table_t< Enum, StringType >( make_enum_table< Enum >() );
+}
+
+template < typename Enum, typename StringType = std::string_view >
+inline constexpr auto enum_table = enum_table_for_string_type< Enum, StringType >();
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename CharT >
+concept unicode_char_type = std::is_same_v< CharT, char8_t > || std::is_same_v< CharT, char16_t >
+                         || std::is_same_v< CharT, char32_t > || std::is_same_v< CharT, wchar_t >;
+
+template < typename StringType >
+struct is_unicode_string_view : std::false_type
+{};
+
+template < unicode_char_type CharT >
+struct is_unicode_string_view< std::basic_string_view< CharT > > : std::true_type
+{};
+
+// utf-8 to utf-8 (`char8_t`), utf-16 (`char16_t`, 16 bit `wchar_t`) or utf-32 (`char32_t`, 32 bit `wchar_t`).
+// `output` is called for every code unit
+template < unicode_char_type CharT, typename Output >
+constexpr void transcode_utf8( std::string_view sv, Output&& output )
+{
+    for ( size_t pos = 0; pos != sv.size(); ) {
+        const uint8_t lead = uint8_t( sv[ pos ] );
+        if constexpr ( sizeof( CharT ) == 1 ) {
+            output( CharT( lead ) );
+            pos += 1;
+        } else {
+            const size_t length     = lead < 0x80 ? 1 : lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : 4;
+            char32_t     code_point = length == 1 ? lead : lead & ( 0x7f >> length );
+            for ( size_t index = 1; index != length; ++index )
+                code_point = ( code_point << 6 ) | ( uint8_t( sv[ pos + index ] ) & 0x3f );
+            pos += length;
+
+            if ( sizeof( CharT ) == 2 && code_point >= 0x10000 ) {
+                output( CharT( 0xd800 + ( ( code_point - 0x10000 ) >> 10 ) ) );
+                output( CharT( 0xdc00 + ( ( code_point - 0x10000 ) & 0x3ff ) ) );
+            } else
+                output( CharT( code_point ) );
+        }
+    }
+}
+
+// the names of `enum_table< Enum >` (sorted), transcoded to `CharT` and stored as one NUL-terminated blob
+template < typename Enum, unicode_char_type CharT >
+struct transcoded_names
+{
+    static constexpr const auto& names = enum_table< Enum >.string_to_enum_table;
+
+    static constexpr size_t blob_size = [] {
+        size_t size = names.size();
+        for ( const auto& element : names )
+            transcode_utf8< CharT >( element.first, [ & ]( CharT ) {
+                size += 1;
+            } );
+        return size;
+    }();
+
+    constexpr transcoded_names()
+    {
+        size_t size = 0;
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), names.size() ) ) {
+            offsets[ index ] = offset_type( size );
+            transcode_utf8< CharT >( names[ index ].first, [ & ]( CharT c ) {
+                blob[ size++ ] = c;
+            } );
+            size += 1; // NUL
+        }
+        offsets[ names.size() ] = offset_type( size );
+    }
+
+    constexpr std::basic_string_view< CharT > operator[]( size_t index ) const
+    {
+        return { blob.data() + offsets[ index ], size_t( offsets[ index + 1 ] - offsets[ index ] - 1 ) };
+    }
+
+    using offset_type = uint_least_for_t< blob_size >;
+
+    std::array< CharT, blob_size >                             blob {};
+    std::array< offset_type, number_of_elements_v< Enum > + 1 > offsets {};
+};
+
+template < typename Enum, typename CharT >
+inline constexpr transcoded_names< Enum, CharT > transcoded_names_of {};
+
+// adapter for the standard character types: maps the names of `enum_table< Enum >` to views into
+// `transcoded_names_of`, so the tables are built at compile time and no strings are converted at runtime
+template < typename Enum, typename CharT >
+struct transcoding_adapter
+{
+    constexpr std::basic_string_view< CharT > operator()( std::string_view name ) const
+    {
+        const auto& names = transcoded_names< Enum, CharT >::names;
+        const auto  found = std::ranges::lower_bound( names, name, {}, []( const auto& element ) {
+            return element.first;
+        } );
+        return transcoded_names_of< Enum, CharT >[ size_t( found - names.begin() ) ];
+    }
+};
+
+template < typename Enum, typename StringType >
+constexpr auto make_adapted_table()
+{
+    if constexpr ( is_unicode_string_view< StringType >::value )
+        return lookup_table_t< Enum, StringType >( enum_table< Enum >,
+                                                   transcoding_adapter< Enum, typename StringType::value_type > {} );
+    else
+        return lookup_table_t< Enum, StringType >( enum_table< Enum > );
+}
+
+// strings and literals of the standard character types are looked up via their `std::basic_string_view`
+template < typename StringType >
+struct adapted_string
+{
+    using type = StringType;
+};
+
+template < unicode_char_type CharT, size_t Size >
+struct adapted_string< CharT[ Size ] >
+{
+    using type = std::basic_string_view< CharT >;
+};
+
+template < unicode_char_type CharT >
+struct adapted_string< const CharT* >
+{
+    using type = std::basic_string_view< CharT >;
+};
+
+template < unicode_char_type CharT, typename Traits, typename Allocator >
+struct adapted_string< std::basic_string< CharT, Traits, Allocator > >
+{
+    using type = std::basic_string_view< CharT >;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// tables for custom string types are built at compile time if `string_adapter< StringType >` is constexpr and
+// `StringType` can be stored in a constexpr variable. otherwise (e.g. for `std::string`) they are function-local
+// statics, which keeps the initialization guard on every call: the dynamic initialization of an inline variable is
+// unordered across translation units, so a static initializer of another translation unit could see it unconstructed
+template < typename Enum, typename StringType >
+concept constexpr_adapted_table = std::is_trivially_destructible_v< StringType > && requires {
+    typename std::bool_constant< ( make_adapted_table< Enum, StringType >(), true ) >;
+};
+
+template < typename Enum, typename StringType >
+    requires constexpr_adapted_table< Enum, StringType >
+inline constexpr auto constexpr_adapted_enum_table = make_adapted_table< Enum, StringType >();
+
+template < typename Enum, typename StringType >
+const auto& adapted_enum_table()
+{
+    static const auto table = make_adapted_table< Enum, StringType >();
+    return table;
+}
+
+template < typename Enum, typename StringType >
+    requires constexpr_adapted_table< Enum, StringType >
+constexpr const auto& adapted_enum_table()
+{
+    return constexpr_adapted_enum_table< Enum, StringType >;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename Type >
+constexpr inline bool string_view_or_int_v
+    = std::is_convertible_v< Type, std::string_view > || std::is_integral_v< Type >;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+constexpr size_t number_of_bitmap_words( size_t bits )
+{
+    return ( bits + 63 ) / 64;
+}
+
+constexpr auto element_getter( std::span< const std::string_view > strings )
+{
+    return [ = ]( size_t index ) {
+        return strings[ index ];
+    };
+}
+
+template < typename Offsets >
+constexpr auto substring_getter( std::string_view buffer, const Offsets& offsets )
+{
+    return [ buffer, &offsets ]( size_t index ) {
+        return buffer.substr( size_t( offsets[ index ] ), size_t( offsets[ index + 1 ] - offsets[ index ] ) );
+    };
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// precomputed masks for enums registered via NOVA_ENUMS_REGISTER_FLAGS
+template < typename EnumType >
+    requires( std::is_enum_v< EnumType > )
+struct flags_table
+{
+    using underlying_type = std::underlying_type_t< EnumType >;
+    using bits_type       = std::make_unsigned_t< underlying_type >;
+
+    static constexpr size_t number_of_bits = sizeof( bits_type ) * 8;
+
+    constexpr explicit flags_table( const auto& table )
+    {
+        for ( EnumType value : table.all_enums() ) {
+            const bits_type bits = bits_type( to_underlying( value ) );
+            if ( bits == 0 )
+                zero_name = table.to_string( value );
+            else if ( std::has_single_bit( bits ) ) {
+                single_bit_mask |= bits;
+                bit_names[ std::countr_zero( bits ) ] = table.to_string( value );
+            }
+        }
+    }
+
+    // valid values are non-empty combinations of registered single-bit values, or registered values (including zero)
+    template < typename IntType >
+        requires( std::is_integral_v< IntType > )
+    constexpr bool is_valid( IntType i ) const
+    {
+        if ( !in_range< underlying_type >( i ) )
+            return false;
+
+        const bits_type bits = bits_type( i );
+        return ( bits != 0 && ( bits & ~single_bit_mask ) == 0 ) || enum_table< EnumType >.is_valid( i );
+    }
+
+    // parses `a|b|c`, spaces around the names are ignored. empty strings are only valid if a zero value is registered
+    constexpr std::optional< EnumType > to_enum( std::string_view sv ) const
+    {
+        if ( std::optional< EnumType > registered = enum_table< EnumType >.to_enum( sv ) )
+            return registered;
+
+        if ( trim( sv ).empty() ) {
+            if ( zero_name.empty() )
+                return std::nullopt;
+            return EnumType( 0 );
+        }
+
+        bits_type bits = 0;
+        while ( !sv.empty() ) {
+            const size_t           separator = sv.find( '|' );
+            const std::string_view name      = trim( sv.substr( 0, separator ) );
+
+            std::optional< EnumType > flag = enum_table< EnumType >.to_enum( name );
+            if ( !flag )
+                return std::nullopt;
+            bits |= bits_type( to_underlying( *flag ) );
+
+            if ( separator == std::string_view::npos )
+                break;
+            sv.remove_prefix( separator + 1 );
+            if ( sv.empty() )
+                return std::nullopt; // trailing separator
+        }
+        return EnumType( bits );
+    }
+
+    template < typename OutputIterator >
+    constexpr OutputIterator to_string( EnumType value, OutputIterator out, std::string_view separator ) const
+    {
+        bits_type bits = bits_type( to_underlying( value ) );
+
+        if ( bits == 0 )
+            return std::ranges::copy( zero_name, out ).out;
+
+        if ( ( bits & ~single_bit_mask ) != 0 )
+            return std::ranges::copy( enum_table< EnumType >.to_string( value ), out ).out;
+
+        out = std::ranges::copy( bit_names[ std::countr_zero( bits ) ], out ).out;
+        bits &= bits - 1;
+        while ( bits ) {
+            out = std::ranges::copy( separator, out ).out;
+            out = std::ranges::copy( bit_names[ std::countr_zero( bits ) ], out ).out;
+            bits &= bits - 1;
+        }
+        return out;
+    }
+
+    // number of characters that `to_string` writes
+    constexpr size_t string_size( EnumType value, std::string_view separator ) const
+    {
+        bits_type bits = bits_type( to_underlying( value ) );
+
+        if ( bits == 0 )
+            return zero_name.size();
+
+        if ( ( bits & ~single_bit_mask ) != 0 )
+            return enum_table< EnumType >.to_string( value ).size();
+
+        size_t size = size_t( std::popcount( bits ) - 1 ) * separator.size();
+        for ( ; bits; bits &= bits - 1 )
+            size += bit_names[ std::countr_zero( bits ) ].size();
+        return size;
+    }
+
+    bits_type                                         single_bit_mask {};
+    std::string_view                                  zero_name {};
+    std::array< std::string_view, number_of_bits > bit_names {};
+
+private:
+    static constexpr std::string_view trim( std::string_view sv )
+    {
+        while ( !sv.empty() && sv.front() == ' ' )
+            sv.remove_prefix( 1 );
+        while ( !sv.empty() && sv.back() == ' ' )
+            sv.remove_suffix( 1 );
+        return sv;
+    }
+};
+
+template < typename EnumType >
+inline constexpr auto enum_flags_table = flags_table< EnumType >( enum_table< EnumType > );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// names sorted (and optionally hashed) under a match policy, which folds characters during comparisons
+template < typename EnumType, match_policy Policy >
+    requires( std::is_enum_v< EnumType > )
+struct folded_lookup_table
+{
+    static constexpr size_t number_of_elements = number_of_elements_v< EnumType >;
+
+    static constexpr bool uses_perfect_hash
+        = string_lookup_strategy< EnumType >::value == string_lookup::perfect_hash;
+
+    using entry = std::pair< std::string_view, EnumType >;
+    using hash_index
+        = std::conditional_t< uses_perfect_hash, perfect_hash_index< number_of_elements, Policy >, no_hash_index >;
+
+    constexpr explicit folded_lookup_table( const std::array< entry, number_of_elements >& string_to_enum_table )
+    {
+        const auto order
+            = sorted_order< number_of_elements, Policy >( std::ranges::views::keys( string_to_enum_table ) );
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            this->string_to_enum_table[ index ] = string_to_enum_table[ order[ index ] ];
+
+        unambiguous = std::ranges::adjacent_find( this->string_to_enum_table, folded_equal< Policy >, &entry::first )
+                   == this->string_to_enum_table.end();
+
+        if constexpr ( uses_perfect_hash )
+            if ( unambiguous )
+                string_hash_index = hash_index { std::ranges::views::keys( this->string_to_enum_table ) };
+    }
+
+    constexpr std::optional< EnumType > to_enum( std::string_view sv ) const
+    {
+        if constexpr ( uses_perfect_hash ) {
+            const entry& candidate = string_to_enum_table[ string_hash_index.find( sv ) ];
+            if ( folded_equal< Policy >( candidate.first, sv ) )
+                return candidate.second;
+            return std::nullopt;
+        }
+
+        auto found = std::ranges::lower_bound( string_to_enum_table, sv, folded_less< Policy >, &entry::first );
+        if ( found != string_to_enum_table.end() && folded_equal< Policy >( found->first, sv ) )
+            return found->second;
+        return std::nullopt;
+    }
+
+    std::array< entry, number_of_elements > string_to_enum_table {};
+    [[no_unique_address]] hash_index        string_hash_index {};
+    bool                                    unambiguous {};
+};
+
+template < typename EnumType, typename Policy >
+inline constexpr auto folded_enum_table
+    = folded_lookup_table< EnumType, Policy >( enum_table< EnumType >.string_to_enum_table );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename EnumType >
+constexpr size_t packed_blob_size()
+{
+    size_t size = 0;
+    for ( const auto& element : enum_table< EnumType >.string_to_enum_table )
+        size += element.first.size() + 1;
+    return size;
+}
+
+template < typename EnumType >
+constexpr size_t longest_name()
+{
+    return std::ranges::max( enum_table< EnumType >.string_to_enum_table | std::ranges::views::keys,
+                             {},
+                             &std::string_view::size )
+        .size();
+}
+
+struct no_table
+{};
+
+// compact alternative to the string_view based tables: names are stored in value order in a single NUL-terminated
+// blob, which is addressed via small offset / length arrays
+template < typename EnumType, size_t BlobSize >
+    requires( std::is_enum_v< EnumType > )
+struct packed_lookup_table
+{
+    static constexpr size_t number_of_elements = number_of_elements_v< EnumType >;
+
+    static constexpr bool uses_perfect_hash
+        = string_lookup_strategy< EnumType >::value == string_lookup::perfect_hash;
+
+    using offset_type = uint_least_for_t< BlobSize >;
+    using length_type = uint_least_for_t< longest_name< EnumType >() >;
+    using index_type  = uint_least_for_t< number_of_elements >;
+
+    using blob_table   = std::array< char, BlobSize >;
+    using offset_table = std::array< offset_type, number_of_elements >;
+    using length_table = std::array< length_type, number_of_elements >;
+    using value_table
+        = std::conditional_t< is_ordinal< EnumType >, no_table, std::array< EnumType, number_of_elements > >;
+    using sorted_table
+        = std::conditional_t< uses_perfect_hash, no_table, std::array< index_type, number_of_elements > >;
+    using hash_index
+        = std::conditional_t< uses_perfect_hash, perfect_hash_index< number_of_elements >, no_hash_index >;
+
+    constexpr explicit packed_lookup_table( const auto& table )
+    {
+        const auto enums = table.all_enums();
+
+        size_t offset = 0;
+        for ( size_t rank : std::ranges::views::iota( size_t( 0 ), number_of_elements ) ) {
+            const std::string_view name = table.to_string( enums[ rank ] );
+
+            std::ranges::copy( name, blob.begin() + offset );
+            offsets[ rank ] = offset_type( offset );
+            lengths[ rank ] = length_type( name.size() );
+            offset += name.size() + 1;
+        }
+
+        if constexpr ( !is_ordinal< EnumType > )
+            values = enums;
+
+        auto ranks = std::ranges::views::iota( size_t( 0 ), number_of_elements );
+        if constexpr ( uses_perfect_hash ) {
+            string_hash_index = hash_index { ranks | std::ranges::views::transform( [ this ]( size_t rank ) {
+                return name( rank );
+            } ) };
+        } else {
+            const auto order = sorted_order< number_of_elements >(
+                ranks | std::ranges::views::transform( [ this ]( size_t rank ) {
+                return name( rank );
+            } ) );
+            std::ranges::copy( order, sorted.begin() );
+        }
+    }
+
+    template < typename IntType >
+        requires( std::is_integral_v< IntType > )
+    constexpr bool is_valid( IntType i ) const
+    {
+        if ( !in_range< std::underlying_type_t< EnumType > >( i ) )
+            return false;
+
+        if constexpr ( is_ordinal< EnumType > )
+            return i >= 0 && size_t( i ) < number_of_elements;
+        else
+            return std::ranges::binary_search( values, EnumType( i ) );
+    }
+
+    constexpr std::string_view to_string( EnumType e ) const
+    {
+        assert( is_valid( to_underlying( e ) ) );
+        return name( rank_of( e ) );
+    }
+
+    constexpr const char* to_c_str( EnumType e ) const
+    {
+        assert( is_valid( to_underlying( e ) ) );
+        return blob.data() + offsets[ rank_of( e ) ];
+    }
+
+    constexpr std::optional< EnumType > to_enum( std::string_view sv ) const
+    {
+        if constexpr ( uses_perfect_hash ) {
+            const size_t rank = string_hash_index.find( sv );
+            if ( name( rank ) == sv )
+                return enum_of( rank );
+            return std::nullopt;
+        } else {
+            auto found = std::ranges::lower_bound( sorted, sv, std::less<> {}, [ this ]( size_t rank ) {
+                return name( rank );
+            } );
+            if ( found != sorted.end() && name( *found ) == sv )
+                return enum_of( *found );
+            return std::nullopt;
+        }
+    }
+
+    blob_table                         blob {};
+    offset_table                       offsets {};
+    length_table                       lengths {};
+    [[no_unique_address]] value_table  values {};
+    [[no_unique_address]] sorted_table sorted {};
+    [[no_unique_address]] hash_index   string_hash_index {};
+
+private:
+    constexpr std::string_view name( size_t rank ) const
+    {
+        return std::string_view { blob.data() + offsets[ rank ], lengths[ rank ] };
+    }
+
+    constexpr size_t rank_of( EnumType e ) const
+    {
+        if constexpr ( is_ordinal< EnumType > )
+            return size_t( to_underlying( e ) );
+        else
+            return size_t( std::ranges::lower_bound( values, e ) - values.begin() );
+    }
+
+    constexpr EnumType enum_of( size_t rank ) const
+    {
+        if constexpr ( is_ordinal< EnumType > )
+            return EnumType( rank );
+        else
+            return values[ rank ];
+    }
+};
+
+template < typename EnumType >
+inline constexpr auto packed_enum_table
+    = packed_lookup_table< EnumType, packed_blob_size< EnumType >() >( enum_table< EnumType > );
+
+template < typename EnumType >
+inline constexpr bool uses_packed_layout
+    = string_layout_strategy< EnumType >::value == string_layout::packed;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// names of up to 16 characters are compared as zero-padded big-endian words (which order like the names) and their
+// length, so that string lookups don't call `memcmp`
+inline constexpr size_t max_word_key_length = 2 * sizeof( uint64_t );
+
+template < std::unsigned_integral Word >
+constexpr Word load_big_endian( const char* data )
+{
+    Word word = 0;
+    for ( size_t index = 0; index != sizeof( Word ); ++index )
+        word = Word( word << 8 ) | uint8_t( data[ index ] );
+    return word;
+}
+
+template < size_t Words >
+struct word_key
+{
+    // `sv` must not be longer than `Words * 8`. the characters are read via overlapping loads of fixed size
+    static constexpr word_key make( std::string_view sv )
+    {
+        const char* const data = sv.data();
+        const size_t      size = sv.size();
+
+        word_key key {
+            .length = uint8_t( size ),
+        };
+
+        if ( size >= 8 ) {
+            key.words[ 0 ] = load_big_endian< uint64_t >( data );
+            if constexpr ( Words == 2 )
+                if ( size > 8 )
+                    key.words[ 1 ] = load_big_endian< uint64_t >( data + size - 8 ) << ( 8 * ( 16 - size ) );
+        } else if ( size >= 4 ) {
+            key.words[ 0 ] = uint64_t( load_big_endian< uint32_t >( data ) ) << 32
+                           | uint64_t( load_big_endian< uint32_t >( data + size - 4 ) ) << ( 8 * ( 8 - size ) );
+        } else if ( size != 0 ) {
+            key.words[ 0 ] = uint64_t( uint8_t( data[ 0 ] ) ) << 56
+                           | uint64_t( uint8_t( data[ size / 2 ] ) ) << ( 56 - 8 * ( size / 2 ) )
+                           | uint64_t( uint8_t( data[ size - 1 ] ) ) << ( 56 - 8 * ( size - 1 ) );
+        }
+        return key;
+    }
+
+    // hash key. the words of names without NUL characters are unique, the combination of two words may collide
+    constexpr uint64_t digest() const
+    {
+        if constexpr ( Words == 1 )
+            return words[ 0 ];
+        else
+            return words[ 0 ] * 0x9e3779b97f4a7c15 ^ words[ 1 ];
+    }
+
+    constexpr auto operator<=>( const word_key& ) const = default;
+
+    std::array< uint64_t, Words > words {};
+    uint8_t                       length {};
+};
+
+// keys and values in the (sorted) order of the names of `enum_table`. the perfect hash is built over the digests of
+// the keys, so that lookups don't hash the string
+template < typename EnumType >
+    requires( std::is_enum_v< EnumType > )
+struct word_key_lookup_table
+{
+    static constexpr size_t number_of_elements = number_of_elements_v< EnumType >;
+    static constexpr size_t number_of_words
+        = std::max( ( longest_name< EnumType >() + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ), size_t( 1 ) );
+
+    using key         = word_key< number_of_words >;
+    using key_table   = std::array< key, number_of_elements >;
+    using value_table = std::array< EnumType, number_of_elements >;
+
+    static constexpr key_table make_keys()
+    {
+        key_table keys {};
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            keys[ index ] = key::make( enum_table< EnumType >.string_to_enum_table[ index ].first );
+        return keys;
+    }
+
+    static constexpr bool unique_digests()
+    {
+        std::array< uint64_t, number_of_elements > digests {};
+        std::ranges::copy( make_keys() | std::ranges::views::transform( &key::digest ), digests.begin() );
+        std::ranges::sort( digests );
+        return std::ranges::adjacent_find( digests ) == digests.end();
+    }
+
+    static constexpr bool uses_perfect_hash
+        = string_lookup_strategy< EnumType >::value == string_lookup::perfect_hash && unique_digests();
+
+    using hash_index
+        = std::conditional_t< uses_perfect_hash, perfect_hash_index< number_of_elements >, no_hash_index >;
+
+    constexpr word_key_lookup_table() :
+        keys {
+            make_keys(),
+        }
+    {
+        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
+            values[ index ] = enum_table< EnumType >.string_to_enum_table[ index ].second;
+
+        if constexpr ( uses_perfect_hash )
+            digest_hash_index = hash_index { keys | std::ranges::views::transform( &key::digest ) };
+    }
+
+    constexpr std::optional< EnumType > to_enum( std::string_view sv ) const
+    {
+        if ( sv.size() > number_of_words * sizeof( uint64_t ) )
+            return std::nullopt;
+
+        const key input = key::make( sv );
+
+        size_t index;
+        if constexpr ( uses_perfect_hash )
+            index = digest_hash_index.find( input.digest() );
+        else
+            index = size_t( std::ranges::lower_bound( keys, input ) - keys.begin() );
+
+        if ( index != number_of_elements && keys[ index ] == input )
+            return values[ index ];
+        return std::nullopt;
+    }
+
+    key_table                        keys {};
+    value_table                      values {};
+    [[no_unique_address]] hash_index digest_hash_index {};
+};
+
+template < typename EnumType >
+inline constexpr word_key_lookup_table< EnumType > word_key_enum_table {};
+
+template < typename EnumType >
+constexpr string_compare default_string_compare()
+{
+    return !uses_packed_layout< EnumType > && longest_name< EnumType >() <= max_word_key_length
+             ? string_compare::word_keys
+             : string_compare::string_views;
+}
+
+// longer names can't be represented as word keys
+template < typename EnumType >
+inline constexpr bool uses_word_keys = string_compare_strategy< EnumType >::value == string_compare::word_keys
+                                    && longest_name< EnumType >() <= max_word_key_length;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// maps registered values to their index in `all_enum_values` in constant time: ordinal enums are indexed directly,
+// dense enums count the valid bits below the value, sparse enums use a perfect hash of the values
+template < typename EnumType, table_kind = kind_of_table< EnumType > >
+struct rank_index
+{
+    constexpr size_t index_of( EnumType e ) const
+    {
+        return size_t( to_underlying( e ) );
+    }
+};
+
+// the validity bitmap is built from the registered values rather than read from `enum_table`, so that enums with the
+// packed layout don't emit the `std::string_view` tables
+template < typename EnumType >
+struct rank_index< EnumType, table_kind::dense >
+{
+    using table_type = std::remove_cvref_t< decltype( enum_table< EnumType > ) >;
+    using rank_type  = uint_least_for_t< number_of_elements_v< EnumType > >;
+
+    constexpr rank_index()
+    {
+        for ( EnumType value : registered_values< EnumType >() ) {
+            const size_t offset = offset_of( value );
+            valid_bits[ offset / 64 ] |= uint64_t( 1 ) << ( offset % 64 );
+        }
+
+        size_t rank = 0;
+        for ( size_t word : std::ranges::views::iota( size_t( 0 ), table_type::number_of_words ) ) {
+            word_ranks[ word ] = rank_type( rank );
+            rank += size_t( std::popcount( valid_bits[ word ] ) );
+        }
+    }
+
+    constexpr size_t index_of( EnumType e ) const
+    {
+        const size_t   offset     = offset_of( e );
+        const uint64_t lower_bits = valid_bits[ offset / 64 ] & ( ( uint64_t( 1 ) << ( offset % 64 ) ) - 1 );
+        return word_ranks[ offset / 64 ] + size_t( std::popcount( lower_bits ) );
+    }
+
+    std::array< uint64_t, table_type::number_of_words >  valid_bits {};
+    std::array< rank_type, table_type::number_of_words > word_ranks {};
+
+private:
+    static constexpr size_t offset_of( EnumType e )
+    {
+        return size_t( uintmax_t( to_underlying( e ) ) - uintmax_t( table_type::min_value ) );
+    }
+};
+
+// ranks are positions in `all_enum_values`, so they are only defined if no value is registered under several names.
+// ordinal and dense enums never have aliases
+template < typename EnumType >
+inline constexpr bool has_distinct_values = kind_of_table< EnumType > != table_kind::sparse || [] {
+    auto values = registered_values< EnumType >();
+    merge_sort( values, []( EnumType lhs, EnumType rhs ) {
+        return to_underlying( lhs ) < to_underlying( rhs );
+    } );
+    return std::ranges::adjacent_find( values ) == values.end();
+}();
+
+template < typename EnumType >
+struct rank_index< EnumType, table_kind::sparse >
+{
+    static_assert( has_distinct_values< EnumType >,
+                   "index_of (and enum_map, enum_set, packed_enum_vector, ...) needs distinct values, but the enum "
+                   "registers a value under several names" );
+
+    static constexpr size_t number_of_elements = number_of_elements_v< EnumType >;
+
+    constexpr rank_index()
+    {
+        // the perfect hash can't be built over duplicate values
+        if constexpr ( has_distinct_values< EnumType > ) {
+            const auto values = enum_table< EnumType >.all_enums();
+            values_hash_index = perfect_hash_index< number_of_elements >(
+                values | std::ranges::views::transform( to_underlying< EnumType > ) );
+        }
+    }
+
+    constexpr size_t index_of( EnumType e ) const
+    {
+        return values_hash_index.find( to_underlying( e ) );
+    }
+
+    perfect_hash_index< number_of_elements > values_hash_index {};
+};
+
+template < typename EnumType >
+inline constexpr rank_index< EnumType > enum_rank_index {};
+
+} // namespace impl
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+inline constexpr bool is_ordinal_v = impl::is_ordinal< EnumType >;
+
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+inline constexpr size_t number_of_elements = impl::number_of_elements_v< EnumType >;
+
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+inline constexpr bool is_flags_enum_v = impl::is_flags_enum< EnumType >::value;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace instrumentation {
+
+enum class operation
+{
+    to_enum_string,
+    to_enum_integer,
+    is_valid,
+    to_string,
+};
+
+inline constexpr size_t number_of_operations = 4;
+
+#if NOVA_ENUMS_ENABLE_INSTRUMENTATION
+
+struct counts
+{
+    uint64_t calls {};
+    uint64_t misses {}; // failed conversions / invalid values
+};
+
+struct enum_counts
+{
+    std::string_view                           enum_name;
+    std::array< counts, number_of_operations > operations {};
+
+    constexpr const counts& operator[]( operation op ) const
+    {
+        return operations[ size_t( op ) ];
+    }
+};
+
+#endif
+
+} // namespace instrumentation
+
+namespace impl {
+
+#if NOVA_ENUMS_ENABLE_INSTRUMENTATION
+
+inline constexpr size_t number_of_counter_shards = 16;
+
+// threads are assigned to shards round-robin, so that concurrent lookups rarely share a cache line
+inline size_t counter_shard()
+{
+    static std::atomic< size_t > next_shard;
+    thread_local const size_t    shard = next_shard.fetch_add( 1, std::memory_order_relaxed );
+    return shard % number_of_counter_shards;
+}
+
+struct enum_counters
+{
+    // calls and misses per operation
+    struct alignas( 64 ) shard
+    {
+        std::array< std::atomic< uint64_t >, 2 * instrumentation::number_of_operations > counters {};
+    };
+
+    constexpr explicit enum_counters( std::string_view name ) :
+        name {
+            name,
+        }
+    {}
+
+    void record( instrumentation::operation op, bool hit )
+    {
+        auto& counters = shards[ counter_shard() ].counters;
+        counters[ 2 * size_t( op ) ].fetch_add( 1, std::memory_order_relaxed );
+        if ( !hit )
+            counters[ 2 * size_t( op ) + 1 ].fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    instrumentation::enum_counts snapshot() const
+    {
+        instrumentation::enum_counts ret { name };
+        for ( const shard& s : shards ) {
+            for ( size_t op = 0; op != instrumentation::number_of_operations; ++op ) {
+                ret.operations[ op ].calls += s.counters[ 2 * op ].load( std::memory_order_relaxed );
+                ret.operations[ op ].misses += s.counters[ 2 * op + 1 ].load( std::memory_order_relaxed );
+            }
+        }
+        return ret;
+    }
+
+    void reset()
+    {
+        for ( shard& s : shards )
+            for ( std::atomic< uint64_t >& counter : s.counters )
+                counter.store( 0, std::memory_order_relaxed );
+    }
+
+    const std::string_view                        name;
+    std::array< shard, number_of_counter_shards > shards {};
+    enum_counters*                                next_instrumented_enum {};
+};
+
+// intrusive list of all enums whose counters are used
+inline std::atomic< enum_counters* > instrumented_enums;
+
+template < typename EnumType >
+inline constinit enum_counters counters_of { is_registered_enum< EnumType >::name };
+
+template < typename EnumType >
+struct counters_registration
+{
+    counters_registration()
+    {
+        enum_counters* counters          = &counters_of< EnumType >;
+        counters->next_instrumented_enum = instrumented_enums.load( std::memory_order_relaxed );
+        while ( !instrumented_enums.compare_exchange_weak(
+            counters->next_instrumented_enum, counters, std::memory_order_release, std::memory_order_relaxed ) )
+            ;
+    }
+};
+
+template < typename EnumType >
+inline const counters_registration< EnumType > registration_of;
+
+#endif
+
+template < typename EnumType >
+constexpr void record( [[maybe_unused]] instrumentation::operation op, [[maybe_unused]] bool hit )
+{
+#if NOVA_ENUMS_ENABLE_INSTRUMENTATION
+    if ( !std::is_constant_evaluated() ) {
+        (void)&registration_of< EnumType >;
+        counters_of< EnumType >.record( op, hit );
+    }
+#endif
+}
+
+} // namespace impl
+
+#if NOVA_ENUMS_ENABLE_INSTRUMENTATION
+
+namespace instrumentation {
+
+// counters of all enums which have been used so far
+inline std::vector< enum_counts > snapshot()
+{
+    std::vector< enum_counts > ret;
+    for ( auto* counters = impl::instrumented_enums.load( std::memory_order_acquire ); counters;
+          counters       = counters->next_instrumented_enum )
+        ret.push_back( counters->snapshot() );
+    return ret;
+}
+
+inline void reset()
+{
+    for ( auto* counters = impl::instrumented_enums.load( std::memory_order_acquire ); counters;
+          counters       = counters->next_instrumented_enum )
+        counters->reset();
+}
+
+} // namespace instrumentation
+
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace impl {
+
+template < typename EnumType, typename IntType >
+constexpr bool is_valid_value( IntType arg )
+{
+    if constexpr ( is_flags_enum_v< EnumType > )
+        return enum_flags_table< EnumType >.is_valid( arg );
+    else if constexpr ( uses_packed_layout< EnumType > )
+        return packed_enum_table< EnumType >.is_valid( arg );
+    else
+        return enum_table< EnumType, std::string_view >.is_valid( arg );
+}
+
+} // namespace impl
+
+template < typename EnumType, typename IntType >
+    requires( is_registered_enum_v< EnumType >, std::is_integral_v< IntType > )
+constexpr bool is_valid( IntType arg )
+{
+    const bool valid = impl::is_valid_value< EnumType >( arg );
+    impl::record< EnumType >( instrumentation::operation::is_valid, valid );
+    return valid;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace impl {
+
+// name of a registered value, without instrumentation, for conversions that the library performs on behalf of the
+// user. combinations of flags have no name of their own
+template < typename EnumType >
+constexpr std::string_view name_of( EnumType value )
+{
+    if constexpr ( uses_packed_layout< EnumType > )
+        return packed_enum_table< EnumType >.to_string( value );
+    else
+        return enum_table< EnumType, std::string_view >.to_string( value );
+}
+
+// length of `to_string( value )`
+template < typename EnumType >
+constexpr size_t string_size( EnumType value )
+{
+    if constexpr ( is_flags_enum_v< EnumType > )
+        return enum_flags_table< EnumType >.string_size( value, "|" );
+    else
+        return name_of( value ).size();
+}
+
+// writes `to_string( value )` to `out`
+template < typename EnumType, typename OutputIterator >
+constexpr OutputIterator write_string( EnumType value, OutputIterator out )
+{
+    if constexpr ( is_flags_enum_v< EnumType > )
+        return enum_flags_table< EnumType >.to_string( value, out, "|" );
+    else
+        return std::ranges::copy( name_of( value ), out ).out;
+}
+
+// invalid values are recorded as misses before the lookup (which asserts for them)
+template < typename EnumType >
+constexpr void record_to_string( [[maybe_unused]] EnumType value )
+{
+#if NOVA_ENUMS_ENABLE_INSTRUMENTATION
+    record< EnumType >( instrumentation::operation::to_string, is_valid_value< EnumType >( to_underlying( value ) ) );
+#endif
+}
+
+} // namespace impl
+
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > && !is_flags_enum_v< EnumType > )
+constexpr std::string_view to_string( EnumType value )
+{
+    impl::record_to_string( value );
+    return impl::name_of( value );
+}
+
+// NUL-terminated name, for C APIs
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+constexpr const char* to_c_str( EnumType value )
+{
+    return impl::packed_enum_table< EnumType >.to_c_str( value );
+}
+
+template < typename StringType, typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+constexpr const StringType& to_string( EnumType value )
+{
+    impl::record_to_string( value );
+    return impl::adapted_enum_table< EnumType, StringType >().to_string( value );
+}
+
+// flag enums: writes the names of all set flags, separated by `separator` (e.g. `a|c`)
+template < typename EnumType, std::output_iterator< char > OutputIterator >
+    requires( is_registered_enum_v< EnumType > && is_flags_enum_v< EnumType > )
+constexpr OutputIterator flags_to_string( EnumType value, OutputIterator out, std::string_view separator = "|" )
+{
+    assert( impl::is_valid_value< EnumType >( to_underlying( value ) ) );
+    return impl::enum_flags_table< EnumType >.to_string( value, out, separator );
+}
+
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > && is_flags_enum_v< EnumType > )
+constexpr std::string flags_to_string( EnumType value, std::string_view separator = "|" )
+{
+    std::string ret;
+    flags_to_string( value, std::back_inserter( ret ), separator );
+    return ret;
+}
+
+// flag enums: combinations are written as `a|c`, so the string is not a view into the tables
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > && is_flags_enum_v< EnumType > )
+constexpr std::string to_string( EnumType value )
+{
+    impl::record_to_string( value );
+    return flags_to_string( value );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace impl {
+
+template < typename Range >
+concept registered_enum_range = std::ranges::input_range< Range >
+                             && std::is_enum_v< std::ranges::range_value_t< Range > >
+                             && is_registered_enum_v< std::ranges::range_value_t< Range > >;
+
+} // namespace impl
+
+// number of characters that `to_string_bulk` writes for `values`
+template < impl::registered_enum_range Values >
+constexpr size_t to_string_bulk_size( const Values& values, std::string_view separator = {} )
+{
+    size_t size     = 0;
+    size_t elements = 0;
+    for ( auto value : values ) {
+        size += impl::string_size( value );
+        elements += 1;
+    }
+
+    return elements ? size + ( elements - 1 ) * separator.size() : 0;
+}
+
+// writes the names of all `values`, separated by `separator`, to `out`
+template < impl::registered_enum_range Values, std::output_iterator< char > OutputIterator >
+constexpr OutputIterator to_string_bulk( const Values& values, std::string_view separator, OutputIterator out )
+{
+    bool first = true;
+    for ( auto value : values ) {
+        if ( !first )
+            out = std::ranges::copy( separator, out ).out;
+        first = false;
+
+        out = impl::write_string( value, out );
+    }
+    return out;
+}
+
+// writes the names of all `values`, separated by `separator`, to `buffer`, which needs to hold at least
+// `to_string_bulk_size( values, separator )` characters. returns the number of written characters
+template < impl::registered_enum_range Values >
+constexpr size_t to_string_bulk( const Values& values, std::string_view separator, std::span< char > buffer )
+{
+    assert( buffer.size() >= to_string_bulk_size( values, separator ) );
+    char* end = to_string_bulk( values, separator, buffer.data() );
+    return size_t( end - buffer.data() );
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+namespace impl {
+
+// string lookup of `to_enum`, without instrumentation
+template < typename EnumType >
+constexpr std::optional< EnumType > string_to_enum( std::string_view sv )
+{
+    if constexpr ( is_flags_enum_v< EnumType > )
+        return enum_flags_table< EnumType >.to_enum( sv );
+    else if constexpr ( uses_word_keys< EnumType > )
+        return word_key_enum_table< EnumType >.to_enum( sv );
+    else if constexpr ( uses_packed_layout< EnumType > )
+        return packed_enum_table< EnumType >.to_enum( sv );
+    else
+        return enum_table< EnumType >.to_enum( sv );
+}
+
+// converts `count` strings like `string_to_enum`. the hash probes of `enum_table` are interleaved, the other tables
+// are probed one string at a time
+template < typename EnumType, typename Get, typename Put >
+constexpr size_t string_to_enum_bulk( size_t count, Get&& get, Put&& put )
+{
+    if constexpr ( !is_flags_enum_v< EnumType > && !uses_packed_layout< EnumType > && !uses_word_keys< EnumType > )
+        return enum_table< EnumType >.to_enum_bulk( count, get, put );
+    else {
+        size_t found = 0;
+        for ( size_t index = 0; index != count; ++index ) {
+            const std::optional< EnumType > value = string_to_enum< EnumType >( get( index ) );
+            found += value.has_value();
+            put( index, value );
+        }
+        return found;
+    }
+}
+
+template < typename EnumType, typename Get >
+constexpr size_t to_enum_bulk( size_t count, Get&& get, std::span< std::optional< EnumType > > result )
+{
+    assert( result.size() >= count );
+    return string_to_enum_bulk< EnumType >( count, get, [ & ]( size_t index, std::optional< EnumType > value ) {
+        result[ index ] = value;
+    } );
+}
+
+template < typename EnumType, typename Get >
+constexpr size_t
+to_enum_bulk( size_t count, Get&& get, std::span< EnumType > result, std::span< uint64_t > valid_bits )
+{
+    assert( result.size() >= count );
+    assert( valid_bits.size() >= number_of_bitmap_words( count ) );
+
+    std::ranges::fill( valid_bits.first( number_of_bitmap_words( count ) ), uint64_t( 0 ) );
+    return string_to_enum_bulk< EnumType >( count, get, [ & ]( size_t index, std::optional< EnumType > value ) {
+        if ( value ) {
+            result[ index ] = *value;
+            valid_bits[ index / 64 ] |= uint64_t( 1 ) << ( index % 64 );
+        }
+    } );
+}
+
+} // namespace impl
+
+template < typename EnumType, typename StringOrInt = std::string_view >
+    requires( is_registered_enum_v< EnumType >, impl::string_view_or_int_v< StringOrInt > )
+constexpr std::optional< EnumType > to_enum( const StringOrInt& string_or_int )
+{
+    std::optional< EnumType > result;
+    if constexpr ( std::is_convertible_v< StringOrInt, std::string_view > )
+        result = impl::string_to_enum< EnumType >( std::string_view { string_or_int } );
+    else if constexpr ( std::is_integral_v< StringOrInt > ) {
+        if ( impl::is_valid_value< EnumType >( string_or_int ) )
+            result = EnumType( string_or_int );
+    }
+
+    impl::record< EnumType >( std::is_integral_v< StringOrInt > ? instrumentation::operation::to_enum_integer
+                                                                : instrumentation::operation::to_enum_string,
+                              result.has_value() );
+    return result;
+}
+
+template < typename EnumType, typename StringOrInt >
+    requires( is_registered_enum_v< EnumType >, !impl::string_view_or_int_v< StringOrInt > )
+constexpr std::optional< EnumType > to_enum( const StringOrInt& string_or_int )
+{
+    using string_type = typename impl::adapted_string< StringOrInt >::type;
+
+    const string_type&        string = string_or_int;
+    std::optional< EnumType > result = impl::adapted_enum_table< EnumType, string_type >().to_enum( string );
+    impl::record< EnumType >( instrumentation::operation::to_enum_string, result.has_value() );
+    return result;
+}
+
+// string lookup under a match policy, e.g. `to_enum< foo >( "Debug", case_insensitive_match {} )`
+template < typename EnumType, impl::match_policy Policy >
+    requires( is_registered_enum_v< EnumType > )
+constexpr std::optional< EnumType > to_enum( std::string_view sv, Policy )
+{
+    if constexpr ( std::is_same_v< Policy, exact_match > )
+        return to_enum< EnumType >( sv );
+    else {
+        static_assert( impl::folded_enum_table< EnumType, Policy >.unambiguous,
+                       "enum names are not unique under this match policy" );
+        std::optional< EnumType > result = impl::folded_enum_table< EnumType, Policy >.to_enum( sv );
+        impl::record< EnumType >( instrumentation::operation::to_enum_string, result.has_value() );
+        return result;
+    }
+}
+
+template < typename EnumType >
+struct prefix_match
+{
+    EnumType value;
+    size_t   length; // number of consumed characters
+};
+
+// parses the longest enum name at the start of `input`, e.g. `parse_prefix< method >( "GET /path" )` consumes `GET`
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+constexpr std::optional< prefix_match< EnumType > > parse_prefix( std::string_view input )
+{
+    if ( auto match = impl::enum_table< EnumType >.parse_prefix( input ) )
+        return prefix_match< EnumType > { match->first, match->second };
+    return std::nullopt;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// bulk conversion: converts `strings[ i ]` to `result[ i ]`. returns the number of converted strings
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+constexpr size_t to_enum_bulk( std::span< const std::string_view >      strings,
+                               std::span< std::optional< EnumType > > result )
+{
+    return impl::to_enum_bulk< EnumType >( strings.size(), impl::element_getter( strings ), result );
+}
+
+// bulk conversion: converts `strings[ i ]` to `result[ i ]` and sets bit `i` in `valid_bits` on success. `result[ i ]`
+// is not modified for strings that are not registered. returns the number of converted strings
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+constexpr size_t to_enum_bulk( std::span< const std::string_view > strings,
+                               std::span< EnumType >                result,
+                               std::span< uint64_t >                valid_bits )
+{
+    return impl::to_enum_bulk< EnumType >( strings.size(), impl::element_getter( strings ), result, valid_bits );
+}
+
+// bulk conversion of strings stored in a contiguous buffer: string `i` is located at
+// `buffer[ offsets[ i ] ... offsets[ i + 1 ] )`
+template < typename EnumType, std::ranges::random_access_range Offsets >
+    requires( is_registered_enum_v< EnumType > && std::is_integral_v< std::ranges::range_value_t< Offsets > > )
+constexpr size_t
+to_enum_bulk( std::string_view buffer, const Offsets& offsets, std::span< std::optional< EnumType > > result )
+{
+    assert( !std::ranges::empty( offsets ) );
+    return impl::to_enum_bulk< EnumType >(
+        std::ranges::size( offsets ) - 1, impl::substring_getter( buffer, offsets ), result );
+}
 
-        return IntType( found->first ) == i;
-    }
+template < typename EnumType, std::ranges::random_access_range Offsets >
+    requires( is_registered_enum_v< EnumType > && std::is_integral_v< std::ranges::range_value_t< Offsets > > )
+constexpr size_t to_enum_bulk( std::string_view      buffer,
+                               const Offsets&        offsets,
+                               std::span< EnumType > result,
+                               std::span< uint64_t > valid_bits )
+{
+    assert( !std::ranges::empty( offsets ) );
+    return impl::to_enum_bulk< EnumType >(
+        std::ranges::size( offsets ) - 1, impl::substring_getter( buffer, offsets ), result, valid_bits );
+}
 
-    constexpr const StringType& to_string( EnumType e ) const
-    {
-        auto found = std::ranges::lower_bound( string_table,
-                                               e,
-                                               std::less<>(),
-                                               []( const std::pair< EnumType, StringType >& element ) {
-            return element.first;
-        } );
+//----------------------------------------------------------------------------------------------------------------------
 
-        if ( found != string_table.end() && found->first == e )
-            return found->second;
+namespace impl {
 
-        assert( false && "enum not found" );
-        unreachable();
-        return string_table.front().second;
+// validation of integer arrays. the checks are branchless in `IntType`, so that the loops over blocks of 64 values are
+// vectorized: a range check for ordinal enums, a range check plus bitmap lookup for dense enums, a comparison with all
+// values for small sparse enums. large sparse enums and flags fall back to `is_valid`
+template < typename EnumType, typename IntType >
+struct bulk_validator
+{
+    static constexpr size_t max_compared_values = 32;
+
+    static constexpr table_kind kind = kind_of_table< EnumType >;
+
+    static constexpr bool uses_range = !is_flags_enum_v< EnumType > && kind != table_kind::sparse;
+    static constexpr bool uses_comparisons = !is_flags_enum_v< EnumType > && kind == table_kind::sparse
+                                          && number_of_elements_v< EnumType > <= max_compared_values;
+
+    static constexpr auto values = registered_values< EnumType >();
+
+    static constexpr auto min_value = to_underlying( std::ranges::min( values, {}, to_underlying< EnumType > ) );
+    static constexpr auto max_value = to_underlying( std::ranges::max( values, {}, to_underlying< EnumType > ) );
+
+    // the registered range, clamped to `IntType`
+    static constexpr bool any_representable
+        = !std::cmp_less( max_value, std::numeric_limits< IntType >::min() )
+       && !std::cmp_greater( min_value, std::numeric_limits< IntType >::max() );
+    static constexpr IntType lowest = std::cmp_less( min_value, std::numeric_limits< IntType >::min() )
+                                        ? std::numeric_limits< IntType >::min()
+                                        : IntType( min_value );
+    static constexpr IntType highest = std::cmp_greater( max_value, std::numeric_limits< IntType >::max() )
+                                         ? std::numeric_limits< IntType >::max()
+                                         : IntType( max_value );
+
+    // the registered values which are representable in `IntType`
+    static constexpr size_t number_of_representable_values = std::ranges::count_if( values, []( EnumType value ) {
+        return in_range< IntType >( to_underlying( value ) );
+    } );
+
+    static constexpr auto representable_values = [] {
+        std::array< IntType, number_of_representable_values > ret {};
+        size_t                                                index = 0;
+        for ( EnumType value : values )
+            if ( in_range< IntType >( to_underlying( value ) ) )
+                ret[ index++ ] = IntType( to_underlying( value ) );
+        return ret;
+    }();
+
+    static constexpr bool is_valid( IntType value )
+    {
+        if constexpr ( uses_range ) {
+            if constexpr ( !any_representable )
+                return false;
+
+            const bool in_range = ( value >= lowest ) & ( value <= highest );
+            if constexpr ( kind == table_kind::ordinal )
+                return in_range;
+            else {
+                // offsets relative to `min_value` are computed modulo 2^N, like `dense_enum_lookup_table::offset_of`
+                constexpr const auto& bits = enum_table< EnumType >.valid_bits;
+                constexpr size_t      span = enum_table< EnumType >.span;
+                if constexpr ( span <= 32 ) {
+                    // 32 bit lanes
+                    constexpr uint32_t mask   = uint32_t( bits[ 0 ] );
+                    const uint32_t     offset = in_range ? uint32_t( value ) - uint32_t( min_value ) : 0;
+                    return in_range & bool( ( mask >> offset ) & 1 );
+                } else {
+                    const size_t offset = in_range ? size_t( uintmax_t( value ) - uintmax_t( min_value ) ) : 0;
+                    return in_range & bool( ( bits[ offset / 64 ] >> ( offset % 64 ) ) & 1 );
+                }
+            }
+        } else if constexpr ( uses_comparisons ) {
+            bool found = false;
+            for ( IntType registered : representable_values )
+                found |= value == registered;
+            return found;
+        } else {
+            return is_valid_value< EnumType >( value );
+        }
     }
 
-    constexpr std::array< EnumType, number_of_elements > all_enums() const
+    // bit `i` is set if `values[ i ]` is valid, for up to 64 values
+    static constexpr uint64_t valid_bits( const IntType* ints, size_t count )
     {
-        std::array< EnumType, number_of_elements > ret;
-        for ( size_t index : std::ranges::views::iota( size_t( 0 ), number_of_elements ) )
-            ret[ index ] = string_table[ index ].first;
-        return ret;
+        std::array< uint8_t, 64 > valid {};
+        for ( size_t index = 0; index != count; ++index )
+            valid[ index ] = is_valid( ints[ index ] );
+
+        uint64_t bits = 0;
+        for ( size_t index = 0; index != 64; ++index )
+            bits |= uint64_t( valid[ index ] ) << index;
+        return bits;
     }
+};
 
+template < typename EnumType, typename IntType >
+constexpr size_t first_invalid( std::span< const IntType > values )
+{
+    for ( size_t block = 0; block < values.size(); block += 64 ) {
+        const size_t   count = std::min( values.size() - block, size_t( 64 ) );
+        const uint64_t bits  = bulk_validator< EnumType, IntType >::valid_bits( values.data() + block, count );
+        if ( std::countr_one( bits ) < int( count ) )
+            return block + size_t( std::countr_one( bits ) );
+    }
+    return values.size();
+}
 
-    string_lookup_table string_table {};
-};
+// contiguous arrays of integers, e.g. `std::vector< int32_t >`, `std::span< const int32_t >` or C arrays
+template < typename Range >
+concept integer_array = std::ranges::contiguous_range< Range > && std::ranges::sized_range< Range >
+                     && std::integral< std::ranges::range_value_t< Range > >;
 
-//----------------------------------------------------------------------------------------------------------------------
+template < integer_array Range >
+constexpr auto as_integer_span( const Range& range )
+{
+    return std::span< const std::ranges::range_value_t< Range > > { range };
+}
 
-template < typename Enum >
-constexpr auto make_enum_table();
+} // namespace impl
 
-template < typename Enum, typename StringType >
-constexpr auto enum_table_for_string_type()
+// index of the first value which is not valid, or `values.size()`
+template < typename EnumType, impl::integer_array Values >
+    requires( is_registered_enum_v< EnumType > )
+constexpr size_t validate_all( const Values& values )
 {
-    if constexpr ( std::is_same_v< StringType, std::string_view > ) {
-        return make_enum_table< Enum >();
-    } else {
-        if constexpr ( is_ordinal< Enum > )
-            return ordinal_enum_lookup_table< Enum, StringType >( make_enum_table< Enum >() );
-        else
-            return enum_lookup_table< Enum, StringType >( make_enum_table< Enum >() );
-    }
+    return impl::first_invalid< EnumType >( impl::as_integer_span( values ) );
 }
 
-template < typename Enum, typename StringType = std::string_view >
-inline constexpr auto enum_table = enum_table_for_string_type< Enum, StringType >();
+// sets bit `i` in `valid_bits` if `values[ i ]` is valid. returns the number of valid values
+template < typename EnumType, impl::integer_array Values >
+    requires( is_registered_enum_v< EnumType > )
+constexpr size_t validate_all( const Values& integers, std::span< uint64_t > valid_bits )
+{
+    using IntType     = std::ranges::range_value_t< Values >;
+    const auto values = impl::as_integer_span( integers );
+    assert( valid_bits.size() >= impl::number_of_bitmap_words( values.size() ) );
 
-template < typename Enum, typename StringType >
-const auto& static_enum_table()
+    size_t valid = 0;
+    for ( size_t block = 0; block < values.size(); block += 64 ) {
+        const size_t   count = std::min( values.size() - block, size_t( 64 ) );
+        const uint64_t bits  = impl::bulk_validator< EnumType, IntType >::valid_bits( values.data() + block, count );
+
+        valid_bits[ block / 64 ] = bits;
+        valid += size_t( std::popcount( bits ) );
+    }
+    return valid;
+}
+
+// bulk conversion of integers: converts `values` up to the first invalid value, whose index is returned (or
+// `values.size()` if all are valid)
+template < typename EnumType, impl::integer_array Values >
+    requires( is_registered_enum_v< EnumType > )
+constexpr size_t to_enum_bulk( const Values& integers, std::span< EnumType > result )
 {
-    static const auto table = enum_table_for_string_type< Enum, StringType >();
-    return table;
+    const auto values = impl::as_integer_span( integers );
+    assert( result.size() >= values.size() );
+
+    const size_t valid = impl::first_invalid< EnumType >( values );
+    for ( size_t index = 0; index != valid; ++index )
+        result[ index ] = EnumType( values[ index ] );
+    return valid;
 }
 
-//----------------------------------------------------------------------------------------------------------------------
+// bulk conversion of integers: converts `values[ i ]` to `result[ i ]` and sets bit `i` in `valid_bits` if it is
+// valid. `result[ i ]` is not modified for invalid values. returns the number of converted values
+template < typename EnumType, impl::integer_array Values >
+    requires( is_registered_enum_v< EnumType > )
+constexpr size_t to_enum_bulk( const Values& integers, std::span< EnumType > result, std::span< uint64_t > valid_bits )
+{
+    using IntType     = std::ranges::range_value_t< Values >;
+    const auto values = impl::as_integer_span( integers );
+    assert( result.size() >= values.size() );
+    assert( valid_bits.size() >= impl::number_of_bitmap_words( values.size() ) );
+
+    size_t converted = 0;
+    for ( size_t block = 0; block < values.size(); block += 64 ) {
+        const size_t   count = std::min( values.size() - block, size_t( 64 ) );
+        const uint64_t bits  = impl::bulk_validator< EnumType, IntType >::valid_bits( values.data() + block, count );
+
+        for ( size_t index = 0; index != count; ++index ) {
+            const bool valid          = ( bits >> index ) & 1;
+            result[ block + index ] = valid ? EnumType( values[ block + index ] ) : result[ block + index ];
+        }
 
-template < typename Type >
-constexpr inline bool string_view_or_int_v
-    = std::is_convertible_v< Type, std::string_view > || std::is_integral_v< Type >;
+        valid_bits[ block / 64 ] = bits;
+        converted += size_t( std::popcount( bits ) );
+    }
+    return converted;
+}
 
-} // namespace impl
 
 //----------------------------------------------------------------------------------------------------------------------
 
 template < typename EnumType >
     requires( is_registered_enum_v< EnumType > )
-inline constexpr bool is_ordinal_v = impl::is_ordinal< EnumType >;
+inline constexpr auto all_enum_values = impl::enum_table< EnumType >.all_enums();
 
+// position of `value` in `all_enum_values`, in constant time. `value` needs to be valid
 template < typename EnumType >
     requires( is_registered_enum_v< EnumType > )
-inline constexpr size_t number_of_elements = impl::number_of_elements_v< EnumType >;
+constexpr size_t index_of( EnumType value )
+{
+    assert( impl::is_valid_value< EnumType >( to_underlying( value ) ) );
+    return impl::enum_rank_index< EnumType >.index_of( value );
+}
+
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+constexpr EnumType from_index( size_t index )
+{
+    assert( index < number_of_elements< EnumType > );
+    return all_enum_values< EnumType >[ index ];
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 
-template < typename EnumType, typename IntType >
-    requires( is_registered_enum_v< EnumType >, std::is_integral_v< IntType > )
-constexpr bool is_valid( IntType arg )
+namespace impl {
+
+// hash over the names and values, in the order of `all_enum_values`. independent of the underlying type, the table
+// layout and whether the tables were generated at build time
+template < typename EnumType >
+constexpr uint64_t compute_schema_fingerprint()
 {
-    return impl::enum_table< EnumType, std::string_view >.is_valid( arg );
+    uint64_t hash = number_of_elements_v< EnumType >;
+    for ( EnumType value : all_enum_values< EnumType > )
+        hash = mix_hash( hash ^ hash_string( name_of( value ) ), uint64_t( to_underlying( value ) ) );
+    return hash;
 }
 
-//----------------------------------------------------------------------------------------------------------------------
+} // namespace impl
 
+// identifies the registered names and values of `EnumType`. peers compare it once before exchanging ranks
 template < typename EnumType >
     requires( is_registered_enum_v< EnumType > )
-constexpr std::string_view to_string( EnumType value )
+inline constexpr uint64_t schema_fingerprint = impl::compute_schema_fingerprint< EnumType >();
+
+// smallest unsigned type which can hold all ranks (`index_of`) of `EnumType`
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+using enum_rank_t = impl::uint_least_for_t< number_of_elements< EnumType > - 1 >;
+
+// compact encoding for serialization: the position in `all_enum_values`. `value` needs to be valid
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+constexpr enum_rank_t< EnumType > encode_rank( EnumType value )
 {
-    return impl::enum_table< EnumType, std::string_view >.to_string( value );
+    return enum_rank_t< EnumType >( index_of( value ) );
 }
 
-template < typename StringType, typename EnumType >
+// inverse of `encode_rank`. ranks are checked, as they are usually received from other processes
+template < typename EnumType >
     requires( is_registered_enum_v< EnumType > )
-auto to_string( EnumType value )
+constexpr std::optional< EnumType > decode_rank( enum_rank_t< EnumType > rank )
 {
-    return impl::static_enum_table< EnumType, StringType >().to_string( value );
+    if ( rank >= number_of_elements< EnumType > )
+        return std::nullopt;
+    return from_index< EnumType >( rank );
 }
 
-
 //----------------------------------------------------------------------------------------------------------------------
 
+namespace impl {
 
-template < typename EnumType, typename StringOrInt = std::string_view >
-    requires( is_registered_enum_v< EnumType >, impl::string_view_or_int_v< StringOrInt > )
-constexpr std::optional< EnumType > to_enum( const StringOrInt& string_or_int )
+template < typename EnumType, typename Visitor >
+using enum_switch_result_t
+    = decltype( std::declval< Visitor >().template operator()< all_enum_values< EnumType >[ 0 ] >() );
+
+// one function per registered value, in the order of `all_enum_values`
+template < typename EnumType, typename Visitor, size_t... Indices >
+constexpr auto make_enum_switch_table( std::index_sequence< Indices... > )
 {
-    if constexpr ( std::is_convertible_v< StringOrInt, std::string_view > )
-        return impl::enum_table< EnumType >.to_enum( std::string_view { string_or_int } );
-    else if constexpr ( std::is_integral_v< StringOrInt > ) {
-        if ( is_valid< EnumType >( string_or_int ) )
-            return EnumType( string_or_int );
-        else
-            return std::nullopt;
-    }
+    using result_type = enum_switch_result_t< EnumType, Visitor >;
+    using function    = result_type ( * )( Visitor&& );
+
+    return std::array< function, sizeof...( Indices ) > {
+        []( Visitor&& visitor ) -> result_type {
+            return std::forward< Visitor >( visitor ).template operator()< all_enum_values< EnumType >[ Indices ] >();
+        }...,
+    };
 }
 
-template < typename EnumType, typename StringOrInt >
-    requires( is_registered_enum_v< EnumType >, !impl::string_view_or_int_v< StringOrInt > )
-std::optional< EnumType > to_enum( const StringOrInt& string_or_int )
+template < typename EnumType, typename Visitor >
+inline constexpr auto enum_switch_table
+    = make_enum_switch_table< EnumType, Visitor >( std::make_index_sequence< number_of_elements_v< EnumType > > {} );
+
+} // namespace impl
+
+// calls `visitor.template operator()< V >()` with the registered value `V` which equals `value`, via a jump table
+// indexed by `index_of`. `value` needs to be valid. all instantiations need to return the same type
+template < typename EnumType, typename Visitor >
+    requires( is_registered_enum_v< EnumType > )
+constexpr decltype( auto ) enum_switch( EnumType value, Visitor&& visitor )
 {
-    return impl::static_enum_table< EnumType, StringOrInt >().to_enum( string_or_int );
+    return impl::enum_switch_table< EnumType, Visitor&& >[ index_of( value ) ]( std::forward< Visitor >( visitor ) );
 }
 
+// calls `function.template operator()< V >()` for all registered values, in the order of `all_enum_values`
+template < typename EnumType, typename Function >
+    requires( is_registered_enum_v< EnumType > )
+constexpr void enum_for_each( Function&& function )
+{
+    [ & ]< size_t... Indices >( std::index_sequence< Indices... > ) {
+        ( function.template operator()< all_enum_values< EnumType >[ Indices ] >(), ... );
+    }( std::make_index_sequence< number_of_elements< EnumType > > {} );
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 
+// memory used by the lookup tables of `EnumType` (including the characters of the names) for the given layout
 template < typename EnumType >
     requires( is_registered_enum_v< EnumType > )
-inline constexpr auto all_enum_values = impl::enum_table< EnumType >.all_enums();
+constexpr size_t table_footprint( string_layout layout = string_layout_strategy< EnumType >::value )
+{
+    if ( layout == string_layout::packed )
+        return sizeof( impl::packed_enum_table< EnumType > );
+
+    size_t footprint = sizeof( impl::enum_table< EnumType > ) + impl::packed_blob_size< EnumType >();
+    if constexpr ( impl::uses_word_keys< EnumType > )
+        footprint += sizeof( impl::word_key_enum_table< EnumType > );
+    return footprint;
+}
 
 template < typename EnumType, typename StringType = std::string_view >
     requires( is_registered_enum_v< EnumType > )
-inline auto all_enum_strings = impl::static_enum_table< EnumType, StringType >().all_enum_strings();
+inline auto all_enum_strings = impl::make_adapted_table< EnumType, StringType >().all_enum_strings();
+
+template < typename EnumType, impl::unicode_char_type CharT >
+    requires( is_registered_enum_v< EnumType > )
+inline constexpr auto all_enum_strings< EnumType, std::basic_string_view< CharT > >
+    = impl::constexpr_adapted_enum_table< EnumType, std::basic_string_view< CharT > >.all_enum_strings();
 
 template < typename EnumType >
     requires( is_registered_enum_v< EnumType > )
 inline constexpr auto all_enum_strings< EnumType, std::string_view >
     = impl::enum_table< EnumType, std::string_view >.all_enum_strings();
 
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace impl {
+
+// values of `To` with the names of the values of `From`, in the order of `all_enum_values< From >`
+template < typename To, typename From >
+inline constexpr auto enum_cast_table = [] {
+    std::array< std::optional< To >, number_of_elements_v< From > > table {};
+    for ( size_t index : std::ranges::views::iota( size_t( 0 ), table.size() ) )
+        table[ index ] = enum_table< To, std::string_view >.to_enum( name_of( all_enum_values< From >[ index ] ) );
+    return table;
+}();
+
+template < typename From, typename To >
+constexpr auto make_missing_names()
+{
+    constexpr const auto& table = enum_cast_table< To, From >;
+
+    constexpr size_t number_of_missing_names = size_t( std::ranges::count( table, std::optional< To > {} ) );
+
+    std::array< std::string_view, number_of_missing_names > names {};
+    auto out = names.begin();
+    for ( size_t index : std::ranges::views::iota( size_t( 0 ), table.size() ) )
+        if ( !table[ index ] )
+            *out++ = name_of( all_enum_values< From >[ index ] );
+    return names;
+}
+
+} // namespace impl
+
+// converts `value` to the value of `To` with the same name. the mapping is computed at compile time and indexed by
+// `index_of`, so no strings are compared. returns `std::nullopt` for values which are not registered (this includes
+// combinations of flags) or whose name is not registered for `To`
+template < typename To, typename From >
+    requires( is_registered_enum_v< To > && is_registered_enum_v< From > )
+constexpr std::optional< To > enum_cast( From value )
+{
+    if ( !impl::enum_table< From, std::string_view >.is_valid( to_underlying( value ) ) )
+        return std::nullopt;
+    return impl::enum_cast_table< To, From >[ index_of( value ) ];
+}
+
+// names of `From` which are not registered for `To`, e.g. `static_assert( missing_names< wire_state, state >.empty() )`
+template < typename From, typename To >
+    requires( is_registered_enum_v< From > && is_registered_enum_v< To > )
+inline constexpr auto missing_names = impl::make_missing_names< From, To >();
+
+// both enums have the same names (not necessarily the same values)
+template < typename Lhs, typename Rhs >
+    requires( is_registered_enum_v< Lhs > && is_registered_enum_v< Rhs > )
+inline constexpr bool have_same_names_v = missing_names< Lhs, Rhs >.empty() && missing_names< Rhs, Lhs >.empty();
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#if NOVA_ENUMS_ENABLE_REGISTRY
+
+namespace registry {
+
+// type-erased view of a registered enum. values are converted to `int64_t`
+struct enum_entry
+{
+    std::string_view                    type_name; // as passed to `NOVA_ENUMS_REGISTER`
+    size_t                              number_of_elements;
+    std::span< const int64_t >          values; // in the order of `all_enum_values`
+    std::span< const std::string_view > names;  // names of `values`
+    uint64_t                            fingerprint;
+
+    // `to_enum( name )` of the enum
+    std::optional< int64_t > ( *to_enum )( std::string_view name );
+};
+
+} // namespace registry
+
+namespace impl {
+
+template < typename EnumType >
+inline constexpr auto registry_values = [] {
+    std::array< int64_t, number_of_elements_v< EnumType > > values {};
+    for ( size_t index : std::ranges::views::iota( size_t( 0 ), values.size() ) )
+        values[ index ] = int64_t( to_underlying( all_enum_values< EnumType >[ index ] ) );
+    return values;
+}();
+
+template < typename EnumType >
+inline constexpr auto registry_names = [] {
+    std::array< std::string_view, number_of_elements_v< EnumType > > names {};
+    for ( size_t index : std::ranges::views::iota( size_t( 0 ), names.size() ) )
+        names[ index ] = name_of( all_enum_values< EnumType >[ index ] );
+    return names;
+}();
+
+template < typename EnumType >
+std::optional< int64_t > registry_to_enum( std::string_view name )
+{
+    std::optional< EnumType > value = nova::enums::to_enum< EnumType >( name );
+    if ( !value )
+        return std::nullopt;
+    return int64_t( to_underlying( *value ) );
+}
+
+struct registered_enum
+{
+    const registry::enum_entry entry;
+    registered_enum*           next_registered_enum {};
+};
+
+// intrusive list of all registered enums, populated during static initialization
+inline std::atomic< registered_enum* > registered_enums;
+
+template < typename EnumType >
+inline constinit registered_enum registry_entry_of { {
+    is_registered_enum< EnumType >::name,
+    number_of_elements_v< EnumType >,
+    registry_values< EnumType >,
+    registry_names< EnumType >,
+    schema_fingerprint< EnumType >,
+    &registry_to_enum< EnumType >,
+} };
+
+template < typename EnumType >
+struct registry_registration
+{
+    registry_registration()
+    {
+        registered_enum* registered      = &registry_entry_of< EnumType >;
+        registered->next_registered_enum = registered_enums.load( std::memory_order_relaxed );
+        while ( !registered_enums.compare_exchange_weak(
+            registered->next_registered_enum, registered, std::memory_order_release, std::memory_order_relaxed ) )
+            ;
+    }
+};
+
+// specialized by the registration macros
+template < typename EnumType >
+extern const registry_registration< EnumType > registry_registration_of;
+
+// open addressing hash table over the type names, built from the list. it is never modified, but replaced when enums
+// have been registered since it was built (by lookups during static initialization or shared libraries which are
+// loaded later), so lookups don't need locks
+struct registry_index
+{
+    registry_index( registered_enum* head, const registry_index* previous ) :
+        head { head },
+        previous { previous }
+    {
+        for ( registered_enum* registered = head; registered; registered = registered->next_registered_enum )
+            entries.push_back( &registered->entry );
+        std::ranges::reverse( entries ); // registration order
+
+        slots.resize( std::bit_ceil( 2 * entries.size() + 1 ) );
+        for ( const registry::enum_entry* entry : entries ) {
+            size_t slot = find_slot( entry->type_name );
+            if ( !slots[ slot ] ) // the same enum may be registered by several shared libraries
+                slots[ slot ] = entry;
+        }
+    }
+
+    size_t find_slot( std::string_view type_name ) const
+    {
+        const size_t mask = slots.size() - 1;
+
+        size_t slot = size_t( mix_hash( hash_string( type_name ), 0 ) ) & mask;
+        while ( slots[ slot ] && slots[ slot ]->type_name != type_name )
+            slot = ( slot + 1 ) & mask;
+        return slot;
+    }
+
+    registered_enum*                           head; // entries are only prepended, so the list is unchanged if equal
+    std::unique_ptr< const registry_index >    previous; // concurrent lookups or `all_enums` may still refer to it
+    std::vector< const registry::enum_entry* > entries;
+    std::vector< const registry::enum_entry* > slots;
+};
+
+// never destroyed, so that lookups from static destructors are safe
+inline std::atomic< const registry_index* > current_registry_index;
+inline std::mutex                           registry_index_mutex;
+
+inline const registry_index& up_to_date_registry_index()
+{
+    registered_enum*      head  = registered_enums.load( std::memory_order_acquire );
+    const registry_index* index = current_registry_index.load( std::memory_order_acquire );
+    if ( index && index->head == head ) [[likely]]
+        return *index;
+
+    std::lock_guard lock( registry_index_mutex );
+    index = current_registry_index.load( std::memory_order_relaxed );
+    head  = registered_enums.load( std::memory_order_acquire );
+    if ( !index || index->head != head ) {
+        index = new registry_index( head, index );
+        current_registry_index.store( index, std::memory_order_release );
+    }
+    return *index;
+}
+
+} // namespace impl
+
+namespace registry {
+
+// all registered enums, in the order of registration
+inline std::span< const enum_entry* const > all_enums()
+{
+    return impl::up_to_date_registry_index().entries;
+}
+
+// `type_name` as passed to `NOVA_ENUMS_REGISTER`, e.g. `my::log_level`. `nullptr` if not registered
+inline const enum_entry* find_enum( std::string_view type_name )
+{
+    const impl::registry_index& index = impl::up_to_date_registry_index();
+    return index.slots[ index.find_slot( type_name ) ];
+}
+
+// value of a qualified name, e.g. `my::log_level::warn`: one hash probe for the type, one for the name
+inline std::optional< int64_t > to_value( std::string_view qualified_name )
+{
+    const size_t separator = qualified_name.rfind( "::" );
+    if ( separator == std::string_view::npos )
+        return std::nullopt;
+
+    const enum_entry* entry = find_enum( qualified_name.substr( 0, separator ) );
+    if ( !entry )
+        return std::nullopt;
+    return entry->to_enum( qualified_name.substr( separator + 2 ) );
+}
+
+} // namespace registry
+
+#endif
+
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -444,46 +3175,73 @@ inline constexpr auto all_enum_strings< EnumType, std::string_view >
 
 //----------------------------------------------------------------------------------------------------------------------
 
+// `(a)(b)(c)` -> `a, b, c,`. the two macros alternate while the sequence is rescanned, so unlike
+// `BOOST_PP_SEQ_ENUM` there is no limit on the length of the sequence
+#define NOVA_ENUMS_IMPL_SEQ_TO_ENUM( SEQ )    NOVA_ENUMS_IMPL_SEQ_TO_ENUM_I( NOVA_ENUMS_IMPL_SEQ_TO_ENUM_A SEQ )
+#define NOVA_ENUMS_IMPL_SEQ_TO_ENUM_I( ... )  NOVA_ENUMS_IMPL_SEQ_TO_ENUM_II( __VA_ARGS__ )
+#define NOVA_ENUMS_IMPL_SEQ_TO_ENUM_II( ... ) __VA_ARGS__##_END
+#define NOVA_ENUMS_IMPL_SEQ_TO_ENUM_A( ... )  __VA_ARGS__, NOVA_ENUMS_IMPL_SEQ_TO_ENUM_B
+#define NOVA_ENUMS_IMPL_SEQ_TO_ENUM_B( ... )  __VA_ARGS__, NOVA_ENUMS_IMPL_SEQ_TO_ENUM_A
+#define NOVA_ENUMS_IMPL_SEQ_TO_ENUM_A_END
+#define NOVA_ENUMS_IMPL_SEQ_TO_ENUM_B_END
+
+// expands macros in the arguments before stringizing
+#define NOVA_ENUMS_IMPL_STRINGIZE( ... )   NOVA_ENUMS_IMPL_STRINGIZE_I( __VA_ARGS__ )
+#define NOVA_ENUMS_IMPL_STRINGIZE_I( ... ) #__VA_ARGS__
+
 #define NOVA_ENUMS_IMPL_MAKE_TABLE_ENTRY_MACRO( r, data, element ) \
     std::pair {                                                    \
         data::element,                                             \
         std::string_view { BOOST_PP_STRINGIZE( element ) },        \
         },
 
-#define NOVA_ENUMS_IMPL_MAKE_ENUM_TABLE_LIST( TYPE, LIST )                                                     \
-                                                                                                               \
-    template <>                                                                                                \
-    constexpr auto nova::enums::impl::make_enum_table< TYPE >()                                                \
-    {                                                                                                          \
-        constexpr auto table_definition = std::to_array< std::pair< TYPE, std::string_view > >(                \
-            { BOOST_PP_LIST_FOR_EACH( NOVA_ENUMS_IMPL_MAKE_TABLE_ENTRY_MACRO, TYPE, LIST ) } );                \
-                                                                                                               \
-        if constexpr ( nova::enums::impl::is_ordinal< TYPE > )                                                 \
-            return nova::enums::impl::ordinal_enum_lookup_table< TYPE, std::string_view >( table_definition ); \
-        else                                                                                                   \
-            return nova::enums::impl::enum_lookup_table< TYPE, std::string_view >( table_definition );         \
+#define NOVA_ENUMS_IMPL_MAKE_ENUM_TABLE_LIST( TYPE, LIST )                                      \
+                                                                                                \
+    template <>                                                                                 \
+    constexpr auto nova::enums::impl::make_enum_table< TYPE >()                                 \
+    {                                                                                           \
+        constexpr auto table_definition = std::to_array< std::pair< TYPE, std::string_view > >( \
+            { BOOST_PP_LIST_FOR_EACH( NOVA_ENUMS_IMPL_MAKE_TABLE_ENTRY_MACRO, TYPE, LIST ) } ); \
+                                                                                                \
+        return nova::enums::impl::lookup_table_t< TYPE, std::string_view >( table_definition ); \
     };
 
-#define NOVA_ENUMS_IMPL_MAKE_ENUM_TABLE( TYPE, ... ) \
-    NOVA_ENUMS_IMPL_MAKE_ENUM_TABLE_LIST( TYPE, BOOST_PP_VARIADIC_TO_LIST( __VA_ARGS__ ) )
+// the variadic form does not iterate over the enumerators in the preprocessor: the whole list is stringized at once and
+// split during constant evaluation, the values are obtained via `using enum`. so it is not limited by the boost.pp
+// iteration limits
+#define NOVA_ENUMS_IMPL_MAKE_ENUM_TABLE( TYPE, ... )                                            \
+                                                                                                \
+    template <>                                                                                 \
+    constexpr auto nova::enums::impl::make_enum_table< TYPE >()                                 \
+    {                                                                                           \
+        constexpr auto table_definition = nova::enums::impl::make_associations(                 \
+            nova::enums::impl::registered_values< TYPE >(),                                     \
+            nova::enums::impl::split_names< nova::enums::impl::number_of_elements_v< TYPE > >(  \
+                NOVA_ENUMS_IMPL_STRINGIZE( __VA_ARGS__ ) ) );                                   \
+                                                                                                \
+        return nova::enums::impl::lookup_table_t< TYPE, std::string_view >( table_definition ); \
+    };
 
 //----------------------------------------------------------------------------------------------------------------------
 
 #define NOVA_ENUMS_IMPL_ENUM_LIST_MACRO( r, data, element ) data::element,
 
-#define NOVA_ENUMS_IMPL_MAKE_ORDINAL_DETECTOR_LIST( TYPE, LIST )                                                  \
-                                                                                                                  \
-    template <>                                                                                                   \
-    constexpr bool nova::enums::impl::determine_ordinality< TYPE >()                                              \
-    {                                                                                                             \
-        constexpr auto table_definition                                                                           \
-            = std::to_array< TYPE >( { BOOST_PP_LIST_FOR_EACH( NOVA_ENUMS_IMPL_ENUM_LIST_MACRO, TYPE, LIST ) } ); \
-                                                                                                                  \
-        return nova::enums::impl::is_ordinal_table( table_definition );                                           \
+#define NOVA_ENUMS_IMPL_MAKE_VALUE_LIST_LIST( TYPE, LIST )                                                         \
+                                                                                                                   \
+    template <>                                                                                                    \
+    constexpr auto nova::enums::impl::registered_values< TYPE >()                                                  \
+    {                                                                                                              \
+        return std::to_array< TYPE >( { BOOST_PP_LIST_FOR_EACH( NOVA_ENUMS_IMPL_ENUM_LIST_MACRO, TYPE, LIST ) } ); \
     }
 
-#define NOVA_ENUMS_IMPL_MAKE_ORDINAL_DETECTOR( TYPE, ... ) \
-    NOVA_ENUMS_IMPL_MAKE_ORDINAL_DETECTOR_LIST( TYPE, BOOST_PP_VARIADIC_TO_LIST( __VA_ARGS__ ) )
+#define NOVA_ENUMS_IMPL_MAKE_VALUE_LIST( TYPE, ... )              \
+                                                                  \
+    template <>                                                   \
+    constexpr auto nova::enums::impl::registered_values< TYPE >() \
+    {                                                             \
+        using enum TYPE;                                          \
+        return std::to_array< TYPE >( { __VA_ARGS__ } );          \
+    }
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -492,56 +3250,135 @@ inline constexpr auto all_enum_strings< EnumType, std::string_view >
     struct nova::enums::impl::number_of_elements< TYPE > : std::integral_constant< size_t, BOOST_PP_LIST_SIZE( LIST ) > \
     {};
 
-#define NOVA_ENUMS_IMPL_MAKE_NUMBER_OF_ELEMENTS( TYPE, ... )                    \
-    template <>                                                                 \
-    struct nova::enums::impl::number_of_elements< TYPE > :                      \
-        std::integral_constant< size_t, BOOST_PP_VARIADIC_SIZE( __VA_ARGS__ ) > \
+#define NOVA_ENUMS_IMPL_MAKE_NUMBER_OF_ELEMENTS( TYPE, ... )                                                         \
+    template <>                                                                                                      \
+    struct nova::enums::impl::number_of_elements< TYPE > :                                                           \
+        std::integral_constant< size_t, nova::enums::impl::count_names( NOVA_ENUMS_IMPL_STRINGIZE( __VA_ARGS__ ) ) > \
     {};
 
 //----------------------------------------------------------------------------------------------------------------------
 
-#define NOVA_ENUMS_IMPL_MAKE_REGISTRATION_TRAIT( TYPE )                   \
-    template <>                                                           \
-    struct nova::enums::impl::is_registered_enum< TYPE > : std::true_type \
+#define NOVA_ENUMS_IMPL_MAKE_REGISTRATION_TRAIT( TYPE )                      \
+    template <>                                                              \
+    struct nova::enums::impl::is_registered_enum< TYPE > : std::true_type    \
+    {                                                                        \
+        static constexpr std::string_view name = BOOST_PP_STRINGIZE( TYPE ); \
+    };
+
+#define NOVA_ENUMS_IMPL_MAKE_FLAGS_TRAIT( TYPE )                     \
+    template <>                                                      \
+    struct nova::enums::impl::is_flags_enum< TYPE > : std::true_type \
     {};
 
+#if NOVA_ENUMS_ENABLE_REGISTRY
+#    define NOVA_ENUMS_IMPL_MAKE_REGISTRY_ENTRY( TYPE )                                    \
+        template <>                                                                       \
+        inline const nova::enums::impl::registry_registration< TYPE >                     \
+            nova::enums::impl::registry_registration_of< TYPE > {};
+#else
+#    define NOVA_ENUMS_IMPL_MAKE_REGISTRY_ENTRY( TYPE )
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
 
 #define NOVA_ENUMS_REGISTER( TYPE, ... )                         \
     NOVA_ENUMS_IMPL_MAKE_REGISTRATION_TRAIT( TYPE )              \
     NOVA_ENUMS_IMPL_MAKE_NUMBER_OF_ELEMENTS( TYPE, __VA_ARGS__ ) \
-    NOVA_ENUMS_IMPL_MAKE_ORDINAL_DETECTOR( TYPE, __VA_ARGS__ )   \
+    NOVA_ENUMS_IMPL_MAKE_VALUE_LIST( TYPE, __VA_ARGS__ )         \
     NOVA_ENUMS_IMPL_MAKE_ENUM_TABLE( TYPE, __VA_ARGS__ )         \
+    NOVA_ENUMS_IMPL_MAKE_REGISTRY_ENTRY( TYPE )                  \
     static_assert( true, "force semicolon" )
 
 #define NOVA_ENUMS_REGISTER_LIST( TYPE, LIST )                 \
     NOVA_ENUMS_IMPL_MAKE_REGISTRATION_TRAIT( TYPE )            \
     NOVA_ENUMS_IMPL_MAKE_NUMBER_OF_ELEMENTS_LIST( TYPE, LIST ) \
-    NOVA_ENUMS_IMPL_MAKE_ORDINAL_DETECTOR_LIST( TYPE, LIST )   \
+    NOVA_ENUMS_IMPL_MAKE_VALUE_LIST_LIST( TYPE, LIST )         \
     NOVA_ENUMS_IMPL_MAKE_ENUM_TABLE_LIST( TYPE, LIST )         \
+    NOVA_ENUMS_IMPL_MAKE_REGISTRY_ENTRY( TYPE )                \
     static_assert( true, "force semicolon" )
 
-#define NOVA_ENUMS_REGISTER_SEQ( TYPE, SEQ )                                          \
-    NOVA_ENUMS_IMPL_MAKE_REGISTRATION_TRAIT( TYPE )                                   \
-    NOVA_ENUMS_IMPL_MAKE_NUMBER_OF_ELEMENTS_LIST( TYPE, BOOST_PP_SEQ_TO_LIST( SEQ ) ) \
-    NOVA_ENUMS_IMPL_MAKE_ORDINAL_DETECTOR_LIST( TYPE, BOOST_PP_SEQ_TO_LIST( SEQ ) )   \
-    NOVA_ENUMS_IMPL_MAKE_ENUM_TABLE_LIST( TYPE, BOOST_PP_SEQ_TO_LIST( SEQ ) )         \
-    static_assert( true, "force semicolon" )
+// sequences are not limited in length
+#define NOVA_ENUMS_REGISTER_SEQ( TYPE, SEQ ) NOVA_ENUMS_REGISTER( TYPE, NOVA_ENUMS_IMPL_SEQ_TO_ENUM( SEQ ) )
+
+// bitmask enums: values can be combined, `to_string` / `flags_to_string` / `to_enum` convert `a|c`
+#define NOVA_ENUMS_REGISTER_FLAGS( TYPE, ... ) \
+    NOVA_ENUMS_IMPL_MAKE_FLAGS_TRAIT( TYPE )   \
+    NOVA_ENUMS_REGISTER( TYPE, __VA_ARGS__ )
+
+#define NOVA_ENUMS_REGISTER_FLAGS_LIST( TYPE, LIST ) \
+    NOVA_ENUMS_IMPL_MAKE_FLAGS_TRAIT( TYPE )         \
+    NOVA_ENUMS_REGISTER_LIST( TYPE, LIST )
+
+#define NOVA_ENUMS_REGISTER_FLAGS_SEQ( TYPE, SEQ ) \
+    NOVA_ENUMS_IMPL_MAKE_FLAGS_TRAIT( TYPE )       \
+    NOVA_ENUMS_REGISTER_SEQ( TYPE, SEQ )
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace nova::enums::impl {
+
+template < typename EnumType >
+inline constexpr bool is_formattable_enum
+    = is_registered_enum_v< EnumType > || NOVA_ENUMS_FORMAT_NUMERIC_FALLBACK;
+
+// formatted values are written to a stack buffer (or point to the table), so formatting does not allocate
+template < typename EnumType >
+constexpr size_t format_buffer_size()
+{
+    constexpr size_t max_digits = std::numeric_limits< std::underlying_type_t< EnumType > >::digits10 + 2;
+    if constexpr ( is_registered_enum_v< EnumType > ) {
+        if constexpr ( is_flags_enum_v< EnumType > )
+            return std::max( packed_blob_size< EnumType >(), max_digits ); // all names, plus separators
+    }
+    return max_digits;
+}
+
+template < typename EnumType >
+using format_buffer = std::array< char, format_buffer_size< EnumType >() >;
+
+template < typename EnumType >
+std::string_view format_numeric( EnumType value, format_buffer< EnumType >& buffer )
+{
+    const auto result
+        = std::to_chars( buffer.data(), buffer.data() + buffer.size(), +std::underlying_type_t< EnumType >( value ) );
+    return std::string_view { buffer.data(), result.ptr };
+}
 
+template < typename EnumType >
+std::string_view format_value( EnumType value, [[maybe_unused]] format_buffer< EnumType >& buffer )
+{
+    if constexpr ( !is_registered_enum_v< EnumType > )
+        return format_numeric( value, buffer );
+    else {
+        if constexpr ( NOVA_ENUMS_FORMAT_NUMERIC_FALLBACK )
+            if ( !is_valid_value< EnumType >( to_underlying( value ) ) )
+                return format_numeric( value, buffer );
+
+        if constexpr ( is_flags_enum_v< EnumType > )
+            return std::string_view { buffer.data(), flags_to_string( value, buffer.data() ) };
+        else
+            return name_of( value );
+    }
+}
+
+} // namespace nova::enums::impl
 
 //----------------------------------------------------------------------------------------------------------------------
 
 #if __has_include( <fmt/format.h> )
 #    include <fmt/format.h>
 
+// the format spec (fill, alignment, width, precision) is applied to the name
 template < typename EnumType >
-    requires( std::is_enum_v< EnumType > )
+    requires( std::is_enum_v< EnumType > && nova::enums::impl::is_formattable_enum< EnumType > )
 struct fmt::formatter< EnumType, char > : fmt::formatter< std::string_view >
 {
     template < typename FormatContext >
     auto format( EnumType value, FormatContext& ctx ) const -> decltype( ctx.out() )
     {
-        return fmt::format_to( ctx.out(), "{}", nova::enums::to_string( value ) );
+        nova::enums::impl::format_buffer< EnumType > buffer;
+        return fmt::formatter< std::string_view >::format( nova::enums::impl::format_value( value, buffer ), ctx );
     }
 };
 
@@ -551,14 +3388,16 @@ struct fmt::formatter< EnumType, char > : fmt::formatter< std::string_view >
 #if __cpp_lib_format
 #    include <format>
 
+// the format spec (fill, alignment, width, precision) is applied to the name
 template < typename EnumType >
-    requires( std::is_enum_v< EnumType > )
+    requires( std::is_enum_v< EnumType > && nova::enums::impl::is_formattable_enum< EnumType > )
 struct std::formatter< EnumType, char > : std::formatter< std::string_view >
 {
     template < typename FormatContext >
     auto format( EnumType value, FormatContext& ctx ) const -> decltype( ctx.out() )
     {
-        return std::format_to( ctx.out(), "{}", nova::enums::to_string( value ) );
+        nova::enums::impl::format_buffer< EnumType > buffer;
+        return std::formatter< std::string_view >::format( nova::enums::impl::format_value( value, buffer ), ctx );
     }
 };
 
@@ -0,0 +1,181 @@
+#pragma once
+
+// Copyright (c) 2023 Tim Blechmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// As a non-binding request, please use this code responsibly and ethically.
+
+
+// used by the generator programs of `nova_enums_generate`: writes registrations whose lookup tables are sorted and
+// hashed already, so that translation units which include them skip the constexpr table construction
+
+#include <nova/enums/enums.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace nova::enums::generator {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace impl {
+
+template < typename EnumType >
+std::string value_literal( EnumType value )
+{
+    const std::string_view type = nova::enums::impl::is_registered_enum< EnumType >::name;
+    const auto             raw  = to_underlying( value );
+
+    std::ostringstream out;
+    out << type << "( ";
+    if constexpr ( std::is_signed_v< decltype( raw ) > ) {
+        if ( int64_t( raw ) == std::numeric_limits< int64_t >::min() )
+            out << "-9223372036854775807ll - 1";
+        else
+            out << int64_t( raw ) << "ll";
+    } else {
+        out << uint64_t( raw ) << "ull";
+    }
+    out << " )";
+    return out.str();
+}
+
+template < typename Range, typename Function >
+void write_list( std::ostream& out, const Range& range, Function&& function )
+{
+    out << "{ {\n";
+    for ( const auto& element : range ) {
+        out << "        ";
+        function( element );
+        out << ",\n";
+    }
+    out << "    } }";
+}
+
+inline const char* table_kind_name( nova::enums::impl::table_kind kind )
+{
+    switch ( kind ) {
+    case nova::enums::impl::table_kind::ordinal: return "ordinal";
+    case nova::enums::impl::table_kind::dense:   return "dense";
+    case nova::enums::impl::table_kind::sparse:  return "sparse";
+    }
+    nova::enums::impl::unreachable();
+}
+
+} // namespace impl
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// registration of `EnumType`, equivalent to its `NOVA_ENUMS_REGISTER`
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+void write_registration( std::ostream& out )
+{
+    namespace ne = nova::enums::impl;
+
+    constexpr size_t size = number_of_elements< EnumType >;
+    const auto&      type = ne::is_registered_enum< EnumType >::name;
+    const auto&      table = ne::enum_table< EnumType >;
+
+    // the hash is emitted even if the string lookup strategy does not use it, so that the strategy can be chosen in
+    // the included headers
+    const ne::perfect_hash_index< size > names_hash { std::ranges::views::keys( table.string_to_enum_table ) };
+
+    out << "// " << type << "\n\n";
+    out << "NOVA_ENUMS_IMPL_MAKE_REGISTRATION_TRAIT( " << type << " )\n";
+    if constexpr ( is_flags_enum_v< EnumType > )
+        out << "NOVA_ENUMS_IMPL_MAKE_FLAGS_TRAIT( " << type << " )\n";
+    out << "\n";
+
+    out << "template <>\n"
+        << "struct nova::enums::impl::number_of_elements< " << type << " > : std::integral_constant< size_t, " << size
+        << " >\n{};\n\n";
+
+    out << "template <>\n"
+        << "inline constexpr nova::enums::impl::table_kind nova::enums::impl::kind_of_table< " << type
+        << " > = nova::enums::impl::table_kind::" << impl::table_kind_name( ne::kind_of_table< EnumType > ) << ";\n\n";
+
+    out << "template <>\n"
+        << "constexpr auto nova::enums::impl::registered_values< " << type << " >()\n{\n"
+        << "    return std::array< " << type << ", " << size << " > ";
+    impl::write_list( out, ne::registered_values< EnumType >(), [ & ]( EnumType value ) {
+        out << impl::value_literal( value );
+    } );
+    out << ";\n}\n\n";
+
+    out << "template <>\n"
+        << "constexpr auto nova::enums::impl::make_enum_table< " << type << " >()\n{\n"
+        << "    return nova::enums::impl::make_presorted_table< " << type << " >(\n    ";
+    impl::write_list( out, all_enum_values< EnumType >, [ & ]( EnumType value ) {
+        out << "{ " << impl::value_literal( value ) << ", \"" << table.to_string( value ) << "\" }";
+    } );
+    out << ",\n    ";
+    impl::write_list( out, table.string_to_enum_table, [ & ]( const auto& element ) {
+        out << "{ \"" << element.first << "\", " << impl::value_literal( element.second ) << " }";
+    } );
+    out << ",\n    ";
+    impl::write_list( out, names_hash.displacements, [ & ]( int32_t displacement ) {
+        out << displacement;
+    } );
+    out << ",\n    ";
+    impl::write_list( out, names_hash.slots, [ & ]( auto slot ) {
+        out << uint64_t( slot );
+    } );
+    out << " );\n}\n\n";
+
+    out << "NOVA_ENUMS_IMPL_MAKE_REGISTRY_ENTRY( " << type << " )\n\n";
+}
+
+// writes the header with the registrations of all `EnumTypes` to `path`. `includes` are the headers which define the
+// enums. the file is only replaced if its content changes, so that dependent translation units are not rebuilt
+template < typename... EnumTypes >
+int write_header( const char* path, std::initializer_list< std::string_view > includes )
+{
+    std::ostringstream out;
+    out << "// generated by nova_enums_generate, do not edit\n\n"
+        << "#pragma once\n\n"
+        << "#include <nova/enums/enums.hpp>\n\n";
+    for ( std::string_view include : includes )
+        out << "#include \"" << include << "\"\n";
+    out << "\n";
+
+    ( write_registration< EnumTypes >( out ), ... );
+
+    const std::string content = std::move( out ).str();
+
+    std::ifstream existing( path, std::ios::binary );
+    if ( existing && std::string( std::istreambuf_iterator< char >( existing ), {} ) == content )
+        return 0;
+    existing.close();
+
+    std::ofstream file( path, std::ios::binary );
+    file << content;
+    return file ? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+} // namespace nova::enums::generator
@@ -0,0 +1,289 @@
+#pragma once
+
+// Copyright (c) 2023 Tim Blechmann
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// As a non-binding request, please use this code responsibly and ethically.
+
+
+#include <nova/enums/enums.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+namespace nova::enums {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// sequence of values of a registered enum, storing `index_of` of every element in the minimal number of bits. elements
+// do not cross word boundaries, so whole words can be decoded with constant shifts
+template < typename EnumType >
+    requires( is_registered_enum_v< EnumType > )
+struct packed_enum_vector
+{
+    static_assert( impl::has_distinct_values< EnumType >, "packed_enum_vector needs an enum without aliased values" );
+
+    static constexpr size_t bits_per_element
+        = std::max( size_t( std::bit_width( number_of_elements< EnumType > - 1 ) ), size_t( 1 ) );
+    static constexpr size_t   elements_per_word = 64 / bits_per_element;
+    static constexpr uint64_t element_mask      = ( uint64_t( 1 ) << bits_per_element ) - 1;
+
+    struct reference
+    {
+        constexpr operator EnumType() const
+        {
+            return vector->get( index );
+        }
+
+        constexpr reference& operator=( EnumType value )
+        {
+            vector->set( index, value );
+            return *this;
+        }
+
+        constexpr reference& operator=( const reference& rhs )
+        {
+            return *this = EnumType( rhs );
+        }
+
+        packed_enum_vector* vector;
+        size_t              index;
+    };
+
+    struct iterator
+    {
+        using value_type      = EnumType;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr EnumType operator*() const
+        {
+            return vector->get( index );
+        }
+
+        constexpr iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        constexpr iterator operator++( int )
+        {
+            iterator ret = *this;
+            ++index;
+            return ret;
+        }
+
+        constexpr bool operator==( const iterator& ) const = default;
+
+        const packed_enum_vector* vector {};
+        size_t                    index {};
+    };
+
+    constexpr packed_enum_vector() = default;
+
+    constexpr packed_enum_vector( size_t count, EnumType value = all_enum_values< EnumType >[ 0 ] )
+    {
+        resize( count, value );
+    }
+
+    constexpr packed_enum_vector( std::span< const EnumType > values )
+    {
+        pack( values );
+    }
+
+    constexpr packed_enum_vector( std::initializer_list< EnumType > values ) :
+        packed_enum_vector( std::span { values.begin(), values.size() } )
+    {}
+
+    constexpr size_t size() const
+    {
+        return element_count;
+    }
+
+    constexpr bool empty() const
+    {
+        return element_count == 0;
+    }
+
+    constexpr void reserve( size_t count )
+    {
+        words.reserve( number_of_words( count ) );
+    }
+
+    constexpr void clear()
+    {
+        words.clear();
+        element_count = 0;
+    }
+
+    constexpr void resize( size_t new_size, EnumType value = all_enum_values< EnumType >[ 0 ] )
+    {
+        const size_t old_size = std::min( element_count, new_size );
+        words.resize( number_of_words( new_size ) );
+        element_count = new_size;
+
+        // the bits after the old end may contain stale elements
+        for ( size_t index = old_size; index != new_size; ++index )
+            set( index, value );
+    }
+
+    constexpr void push_back( EnumType value )
+    {
+        if ( element_count % elements_per_word == 0 )
+            words.push_back( 0 );
+        set( element_count++, value );
+    }
+
+    constexpr void pop_back()
+    {
+        assert( !empty() );
+        if ( --element_count % elements_per_word == 0 )
+            words.pop_back();
+    }
+
+    constexpr EnumType operator[]( size_t index ) const
+    {
+        assert( index < element_count );
+        return get( index );
+    }
+
+    constexpr reference operator[]( size_t index )
+    {
+        assert( index < element_count );
+        return reference { this, index };
+    }
+
+    constexpr iterator begin() const
+    {
+        return iterator { this, 0 };
+    }
+
+    constexpr iterator end() const
+    {
+        return iterator { this, element_count };
+    }
+
+    // appends all `values`
+    constexpr void pack( std::span< const EnumType > values )
+    {
+        reserve( element_count + values.size() );
+        const EnumType* it  = values.data();
+        const EnumType* end = it + values.size();
+
+        // fill the partially used last word
+        for ( ; it != end && element_count % elements_per_word != 0; ++it )
+            push_back( *it );
+
+        // whole words
+        for ( ; end - it >= std::ptrdiff_t( elements_per_word ); it += elements_per_word ) {
+            uint64_t word = 0;
+            for ( size_t element = 0; element != elements_per_word; ++element )
+                word |= uint64_t( index_of( it[ element ] ) ) << ( element * bits_per_element );
+            words.push_back( word );
+            element_count += elements_per_word;
+        }
+
+        for ( ; it != end; ++it )
+            push_back( *it );
+    }
+
+    // decodes `out.size()` elements, starting at `first`
+    constexpr void unpack( std::span< EnumType > out, size_t first = 0 ) const
+    {
+        assert( first + out.size() <= element_count );
+        EnumType*       it  = out.data();
+        EnumType* const end = it + out.size();
+
+        size_t index = first;
+        for ( ; it != end && index % elements_per_word != 0; ++it )
+            *it = get( index++ );
+
+        // whole words, with constant shifts
+        const uint64_t* word = words.data() + index / elements_per_word;
+        for ( ; end - it >= std::ptrdiff_t( elements_per_word ); it += elements_per_word, index += elements_per_word ) {
+            const uint64_t bits = *word++;
+            for ( size_t element = 0; element != elements_per_word; ++element )
+                it[ element ] = from_rank( ( bits >> ( element * bits_per_element ) ) & element_mask );
+        }
+
+        for ( ; it != end; ++it )
+            *it = get( index++ );
+    }
+
+    constexpr std::vector< EnumType > unpack() const
+    {
+        std::vector< EnumType > ret( element_count );
+        unpack( ret );
+        return ret;
+    }
+
+    // memory used by the elements
+    constexpr size_t footprint() const
+    {
+        return words.size() * sizeof( uint64_t );
+    }
+
+    friend constexpr bool operator==( const packed_enum_vector& lhs, const packed_enum_vector& rhs )
+    {
+        if ( lhs.element_count != rhs.element_count )
+            return false;
+        return std::ranges::equal( lhs, rhs );
+    }
+
+private:
+    static constexpr size_t number_of_words( size_t count )
+    {
+        return ( count + elements_per_word - 1 ) / elements_per_word;
+    }
+
+    // ordinal enums decode without a table lookup
+    static constexpr EnumType from_rank( uint64_t rank )
+    {
+        if constexpr ( is_ordinal_v< EnumType > )
+            return EnumType( rank );
+        else
+            return all_enum_values< EnumType >[ size_t( rank ) ];
+    }
+
+    constexpr EnumType get( size_t index ) const
+    {
+        const uint64_t word = words[ index / elements_per_word ];
+        return from_rank( ( word >> ( index % elements_per_word * bits_per_element ) ) & element_mask );
+    }
+
+    constexpr void set( size_t index, EnumType value )
+    {
+        const size_t shift = index % elements_per_word * bits_per_element;
+        uint64_t&    word  = words[ index / elements_per_word ];
+        word               = ( word & ~( element_mask << shift ) ) | ( uint64_t( index_of( value ) ) << shift );
+    }
+
+    std::vector< uint64_t > words;
+    size_t                  element_count {};
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+} // namespace nova::enums
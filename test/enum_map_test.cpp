@@ -0,0 +1,73 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/enums/enum_map.hpp>
+
+#include <string>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace enum_map_test {
+
+enum class ordinal
+{
+    a,
+    b,
+    c,
+};
+
+enum class dense
+{
+    a = 1,
+    b = 2,
+    c = 4,
+};
+
+enum class sparse
+{
+    a = 1000,
+    b = -5,
+    c = 70000,
+};
+
+} // namespace enum_map_test
+
+NOVA_ENUMS_REGISTER( enum_map_test::ordinal, a, b, c );
+NOVA_ENUMS_REGISTER( enum_map_test::dense, a, b, c );
+NOVA_ENUMS_REGISTER( enum_map_test::sparse, a, b, c );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace nova::enums {
+
+using namespace enum_map_test;
+
+static_assert( enum_map< sparse, int >::size() == 3 );
+static_assert( enum_map< sparse, int > { { sparse::c, 7 } }[ sparse::c ] == 7 );
+static_assert( enum_map< dense, int > { { dense::b, 2 }, { dense::c, 4 } }.values == std::array { 0, 2, 4 } );
+
+TEST_CASE( "enum_map" )
+{
+    enum_map< sparse, std::string > names;
+    names[ sparse::a ] = "a";
+    names[ sparse::c ] = "c";
+
+    CHECK( names[ sparse::a ] == "a" );
+    CHECK( names[ sparse::b ].empty() );
+    CHECK( names[ sparse::c ] == "c" );
+
+    size_t index = 0;
+    for ( auto [ key, value ] : names.items() ) {
+        CHECK( key == all_enum_values< sparse >[ index++ ] );
+        CHECK( value == names[ key ] );
+    }
+    CHECK( index == 3 );
+
+    enum_map< ordinal, int > counters;
+    counters.fill( 1 );
+    counters[ ordinal::b ] += 1;
+    for ( auto [ key, value ] : counters.items() )
+        value *= 10;
+    CHECK( counters == enum_map< ordinal, int > { { ordinal::a, 10 }, { ordinal::b, 20 }, { ordinal::c, 10 } } );
+}
+
+} // namespace nova::enums
@@ -0,0 +1,81 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/enums/enum_set.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace enum_set_test {
+
+enum class sparse
+{
+    a = 1000,
+    b = -5,
+    c = 70000,
+    d = 3,
+};
+
+// 70 enumerators: two words
+enum class wide
+{
+    BOOST_PP_ENUM_PARAMS( 70, value_ )
+};
+
+} // namespace enum_set_test
+
+NOVA_ENUMS_REGISTER( enum_set_test::sparse, a, b, c, d );
+NOVA_ENUMS_REGISTER( enum_set_test::wide, BOOST_PP_ENUM_PARAMS( 70, value_ ) );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace nova::enums {
+
+using namespace enum_set_test;
+
+static_assert( std::ranges::input_range< enum_set< sparse > > );
+static_assert( enum_set< sparse >::number_of_words == 1 );
+static_assert( enum_set< wide >::number_of_words == 2 );
+static_assert( enum_set< sparse >::all().size() == 4 );
+static_assert( enum_set< wide >::all().size() == 70 );
+static_assert( enum_set< sparse > { sparse::a, sparse::c }.contains( sparse::c ) );
+static_assert( !enum_set< sparse > { sparse::a, sparse::c }.contains( sparse::b ) );
+static_assert( ( ~enum_set< sparse > { sparse::a } ).size() == 3 );
+
+TEST_CASE( "enum_set" )
+{
+    enum_set< sparse > set;
+    CHECK( set.empty() );
+
+    set.insert( sparse::c );
+    set.insert( sparse::b );
+    set.insert( sparse::c );
+    CHECK( set.size() == 2 );
+    CHECK( set.contains( sparse::b ) );
+    CHECK( !set.contains( sparse::a ) );
+
+    set.erase( sparse::b );
+    CHECK( set == enum_set< sparse > { sparse::c } );
+
+    const enum_set< sparse > lhs { sparse::a, sparse::b };
+    const enum_set< sparse > rhs { sparse::b, sparse::c };
+    CHECK( ( lhs | rhs ) == enum_set< sparse > { sparse::a, sparse::b, sparse::c } );
+    CHECK( ( lhs & rhs ) == enum_set< sparse > { sparse::b } );
+    CHECK( ( lhs - rhs ) == enum_set< sparse > { sparse::a } );
+
+    // iteration in the order of `all_enum_values`
+    std::vector< sparse > values;
+    std::ranges::copy( lhs, std::back_inserter( values ) );
+    CHECK( values == std::vector { sparse::b, sparse::a } );
+
+    enum_set< wide > wide_set { wide::value_3, wide::value_69, wide::value_64 };
+    std::vector< wide > wide_values;
+    for ( wide value : wide_set )
+        wide_values.push_back( value );
+    CHECK( wide_values == std::vector { wide::value_3, wide::value_64, wide::value_69 } );
+    CHECK( enum_set< wide > {}.begin() == enum_set< wide > {}.end() );
+}
+
+} // namespace nova::enums
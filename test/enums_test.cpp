@@ -5,6 +5,9 @@
 
 #include <fmt/format.h>
 
+#include <string>
+#include <vector>
+
 //----------------------------------------------------------------------------------------------------------------------
 
 enum class foo
@@ -34,6 +37,302 @@ NOVA_ENUMS_REGISTER( bar, a, b, c );
 
 //----------------------------------------------------------------------------------------------------------------------
 
+enum class status : uint8_t
+{
+    ok      = 1,
+    warning = 2,
+    error   = 4,
+};
+
+NOVA_ENUMS_REGISTER( status, ok, warning, error );
+
+enum class offset_enum
+{
+    x = -101,
+    y = -100,
+    z = -98,
+};
+
+NOVA_ENUMS_REGISTER( offset_enum, x, y, z );
+
+// values registered under several names
+
+enum class aliased_color
+{
+    red     = 1,
+    crimson = 1,
+    green   = 2,
+};
+
+NOVA_ENUMS_REGISTER( aliased_color, red, crimson, green );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+enum class permission : uint8_t
+{
+    none    = 0,
+    read    = 1 << 0,
+    write   = 1 << 1,
+    execute = 1 << 3,
+    all     = read | write | execute,
+};
+
+NOVA_ENUMS_REGISTER_FLAGS( permission, none, read, write, execute, all );
+
+constexpr permission operator|( permission lhs, permission rhs )
+{
+    return permission( nova::enums::to_underlying( lhs ) | nova::enums::to_underlying( rhs ) );
+}
+
+// flags without a zero value
+enum class access_mode
+{
+    read  = 1,
+    write = 2,
+};
+
+NOVA_ENUMS_REGISTER_FLAGS( access_mode, read, write );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+enum class log_level
+{
+    debug,
+    info,
+    warning,
+    fatal_error,
+};
+
+NOVA_ENUMS_REGISTER( log_level, debug, info, warning, fatal_error );
+
+enum class mixed_case
+{
+    value,
+    Value,
+};
+
+NOVA_ENUMS_REGISTER( mixed_case, value, Value );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+enum class opcode
+{
+    nop,
+    load,
+    store,
+    add,
+    sub,
+    mul,
+    div,
+    mod,
+    bit_and,
+    bit_or,
+    bit_xor,
+    shift_left,
+    shift_right,
+    jump,
+    jump_if_zero,
+    jump_if_not_zero,
+    call,
+    ret,
+    push,
+    pop,
+};
+
+NOVA_ENUMS_REGISTER( opcode,
+                     nop,
+                     load,
+                     store,
+                     add,
+                     sub,
+                     mul,
+                     div,
+                     mod,
+                     bit_and,
+                     bit_or,
+                     bit_xor,
+                     shift_left,
+                     shift_right,
+                     jump,
+                     jump_if_zero,
+                     jump_if_not_zero,
+                     call,
+                     ret,
+                     push,
+                     pop );
+
+enum class sorted_opcode
+{
+    nop  = 10,
+    load = 20,
+    store,
+};
+
+template <>
+struct nova::enums::string_lookup_strategy< sorted_opcode > :
+    std::integral_constant< nova::enums::string_lookup, nova::enums::string_lookup::sorted_table >
+{};
+
+template <>
+struct nova::enums::string_layout_strategy< sorted_opcode > :
+    std::integral_constant< nova::enums::string_layout, nova::enums::string_layout::packed >
+{};
+
+NOVA_ENUMS_REGISTER( sorted_opcode, nop, load, store );
+
+enum class packed_opcode
+{
+    nop,
+    load,
+    store,
+    add,
+    sub,
+};
+
+template <>
+struct nova::enums::string_layout_strategy< packed_opcode > :
+    std::integral_constant< nova::enums::string_layout, nova::enums::string_layout::packed >
+{};
+
+NOVA_ENUMS_REGISTER( packed_opcode, nop, load, store, add, sub );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+enum class sequence
+{
+    first  = 10,
+    second = 5,
+    third  = 7,
+};
+
+NOVA_ENUMS_REGISTER_SEQ( sequence, ( first )( second )( third ) );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// sparse enums with the eytzinger layout: selected explicitly and by size
+
+enum class error_code : int32_t
+{
+    not_found = -404,
+    ok        = 0,
+    timeout   = 7,
+    overflow  = 2147483647,
+    underflow = -2147483647 - 1,
+};
+
+template <>
+struct nova::enums::value_lookup_strategy< error_code > :
+    std::integral_constant< nova::enums::value_lookup, nova::enums::value_lookup::eytzinger >
+{};
+
+NOVA_ENUMS_REGISTER( error_code, not_found, ok, timeout, overflow, underflow );
+
+#define ERROR_CATALOG_ENUMERATOR( z, n, data ) code_##n = n * 7919 - 100000,
+
+enum class error_catalog
+{
+    BOOST_PP_REPEAT( 200, ERROR_CATALOG_ENUMERATOR, ~ )
+};
+
+NOVA_ENUMS_REGISTER( error_catalog, BOOST_PP_ENUM_PARAMS( 200, code_ ) );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// shares some names with `foo` and `bar`
+
+enum class wire_foo : int16_t
+{
+    c = -3000,
+    a = 7,
+    d = 9000,
+};
+
+NOVA_ENUMS_REGISTER( wire_foo, c, a, d );
+
+// same names and values as `foo`, different underlying type
+namespace v2 {
+
+enum class foo : uint8_t
+{
+    a,
+    b,
+    c,
+};
+
+} // namespace v2
+
+NOVA_ENUMS_REGISTER( v2::foo, a, b, c );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// names around the word boundaries of the word keys
+
+enum class token
+{
+    abcdefg,
+    abcdefgh,
+    abcdefghi,
+    abcdefghijklmnop,
+};
+
+NOVA_ENUMS_REGISTER( token, abcdefg, abcdefgh, abcdefghi, abcdefghijklmnop );
+
+enum class sorted_token
+{
+    abcdefg,
+    abcdefgh,
+    abcdefghi,
+    abcdefghijklmnop,
+};
+
+template <>
+struct nova::enums::string_lookup_strategy< sorted_token > :
+    std::integral_constant< nova::enums::string_lookup, nova::enums::string_lookup::sorted_table >
+{};
+
+NOVA_ENUMS_REGISTER( sorted_token, abcdefg, abcdefgh, abcdefghi, abcdefghijklmnop );
+
+enum class string_view_token
+{
+    abcdefg,
+    abcdefgh,
+    abcdefghi,
+    abcdefghijklmnop,
+};
+
+template <>
+struct nova::enums::string_compare_strategy< string_view_token > :
+    std::integral_constant< nova::enums::string_compare, nova::enums::string_compare::string_views >
+{};
+
+NOVA_ENUMS_REGISTER( string_view_token, abcdefg, abcdefgh, abcdefghi, abcdefghijklmnop );
+
+enum class long_token
+{
+    abcdefghijklmnopq,
+    a,
+};
+
+NOVA_ENUMS_REGISTER( long_token, abcdefghijklmnopq, a );
+
+// names which only differ after the first 8 bytes, in a non-ASCII character
+
+enum class utf8_token
+{
+    xaaaaaaaaaé,
+    xaaaaaaaaaz,
+    yb,
+};
+
+template <>
+struct nova::enums::string_lookup_strategy< utf8_token > :
+    std::integral_constant< nova::enums::string_lookup, nova::enums::string_lookup::sorted_table >
+{};
+
+NOVA_ENUMS_REGISTER( utf8_token, xaaaaaaaaaé, xaaaaaaaaaz, yb );
+
+//----------------------------------------------------------------------------------------------------------------------
+
 namespace nova::enums {
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -53,6 +352,230 @@ static_assert( is_valid< bar >( 22 ) );
 static_assert( is_valid< bar >( -222 ) );
 static_assert( !is_valid< bar >( 23 ) );
 
+static_assert( impl::kind_of_table< foo > == impl::table_kind::ordinal );
+static_assert( impl::kind_of_table< bar > == impl::table_kind::sparse );
+static_assert( impl::kind_of_table< status > == impl::table_kind::dense );
+static_assert( impl::kind_of_table< offset_enum > == impl::table_kind::dense );
+static_assert( impl::kind_of_table< aliased_color > == impl::table_kind::sparse );
+
+static_assert( std::ranges::equal( all_enum_values< aliased_color >,
+                                   std::array { aliased_color( 1 ), aliased_color( 1 ), aliased_color( 2 ) } ) );
+static_assert( to_enum< aliased_color >( "crimson" ) == aliased_color::red );
+static_assert( to_enum< aliased_color >( 2 ) == aliased_color::green );
+static_assert( is_valid< aliased_color >( 1 ) );
+static_assert( !is_valid< aliased_color >( 0 ) );
+static_assert( to_string( aliased_color::green ) == "green" );
+
+// `index_of` and the containers reject aliased enums with a static_assert
+static_assert( !impl::has_distinct_values< aliased_color > );
+static_assert( impl::has_distinct_values< bar > );
+static_assert( impl::has_distinct_values< error_catalog > );
+
+static_assert( is_valid< status >( 1 ) );
+static_assert( is_valid< status >( 4 ) );
+static_assert( !is_valid< status >( 0 ) );
+static_assert( !is_valid< status >( 3 ) );
+static_assert( !is_valid< status >( 5 ) );
+static_assert( !is_valid< status >( 257 ) );
+static_assert( !is_valid< status >( -255 ) );
+
+static_assert( number_of_elements< sequence > == 3 );
+static_assert( to_enum< sequence >( "third" ) == sequence::third );
+static_assert( to_string( sequence::second ) == "second" );
+static_assert( impl::count_names( " a, b ,\n c, " ) == 3 );
+static_assert( impl::split_names< 2 >( "a ,b," )[ 1 ] == "b" );
+
+static_assert( index_of( foo::c ) == 2 );
+static_assert( index_of( bar::c ) == 0 );
+static_assert( index_of( bar::b ) == 2 );
+static_assert( index_of( status::error ) == 2 );
+static_assert( index_of( offset_enum::z ) == 2 );
+static_assert( from_index< bar >( 1 ) == bar::a );
+
+static_assert( enum_cast< bar >( foo::b ) == bar::b );
+static_assert( enum_cast< foo >( bar::c ) == foo::c );
+static_assert( enum_cast< wire_foo >( foo::b ) == std::nullopt );
+static_assert( enum_cast< foo >( wire_foo::a ) == foo::a );
+static_assert( enum_cast< foo >( wire_foo( 8 ) ) == std::nullopt );
+static_assert( missing_names< foo, bar >.empty() );
+static_assert( have_same_names_v< foo, bar > );
+static_assert( !have_same_names_v< foo, wire_foo > );
+static_assert( std::ranges::equal( missing_names< foo, wire_foo >, std::array { std::string_view { "b" } } ) );
+static_assert( std::ranges::equal( missing_names< wire_foo, foo >, std::array { std::string_view { "d" } } ) );
+
+static_assert( schema_fingerprint< foo > == schema_fingerprint< v2::foo > );
+static_assert( schema_fingerprint< foo > != schema_fingerprint< bar > ); // same names
+static_assert( schema_fingerprint< foo > != schema_fingerprint< sequence > ); // same values
+static_assert( std::is_same_v< enum_rank_t< foo >, uint8_t > );
+static_assert( std::is_same_v< enum_rank_t< error_catalog >, uint8_t > );
+static_assert( std::is_same_v< enum_rank_t< opcode >, uint8_t > );
+static_assert( encode_rank( bar::a ) == 1 );
+static_assert( decode_rank< bar >( 2 ) == bar::b );
+static_assert( decode_rank< bar >( 3 ) == std::nullopt );
+
+namespace {
+
+template < auto Value >
+constexpr int value_of = int( Value ) * 10;
+
+struct value_visitor
+{
+    template < auto Value >
+    constexpr int operator()() const
+    {
+        return value_of< Value >;
+    }
+};
+
+struct status_recorder
+{
+    template < status Value >
+    void operator()()
+    {
+        visited.push_back( Value );
+    }
+
+    std::vector< status > visited;
+};
+
+constexpr int sum_of_values()
+{
+    int sum = 0;
+    enum_for_each< bar >( [ & ]< bar Value >() {
+        sum += int( Value );
+    } );
+    return sum;
+}
+
+} // namespace
+
+static_assert( enum_switch( bar::b, value_visitor {} ) == 220 );
+static_assert( enum_switch( bar::c, value_visitor {} ) == -2220 );
+static_assert( enum_switch( offset_enum::z, value_visitor {} ) == value_of< offset_enum::z > );
+static_assert( sum_of_values() == 2 + 22 - 222 );
+
+static_assert( impl::enum_table< error_code >.uses_eytzinger );
+static_assert( impl::enum_table< error_catalog >.uses_eytzinger );
+static_assert( !impl::enum_table< bar >.uses_eytzinger );
+static_assert( is_valid< error_code >( -2147483647 - 1 ) );
+static_assert( !is_valid< error_code >( int64_t( 2147483648 ) ) );
+static_assert( to_string( error_code::overflow ) == "overflow" );
+static_assert( to_string( error_catalog::code_199 ) == "code_199" );
+
+static_assert( is_valid< offset_enum >( -98 ) );
+static_assert( !is_valid< offset_enum >( -99 ) );
+static_assert( !is_valid< offset_enum >( -102 ) );
+static_assert( !is_valid< offset_enum >( uint64_t( -100 ) ) );
+
+static_assert( to_string( status::warning ) == "warning" );
+static_assert( to_string( offset_enum::z ) == "z" );
+static_assert( to_enum< offset_enum >( -100 ) == offset_enum::y );
+static_assert( all_enum_values< status > == std::array { status::ok, status::warning, status::error } );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static_assert( is_flags_enum_v< permission > );
+static_assert( !is_flags_enum_v< foo > );
+
+static_assert( is_valid< permission >( 0 ) );
+static_assert( is_valid< permission >( 0b1011 ) );
+static_assert( is_valid< permission >( 0b1001 ) );
+static_assert( !is_valid< permission >( 0b0100 ) );
+static_assert( !is_valid< permission >( 0b1100 ) );
+static_assert( !is_valid< permission >( 256 ) );
+
+static_assert( to_enum< permission >( "read|execute" ) == ( permission::read | permission::execute ) );
+static_assert( to_enum< permission >( "write | read" ) == ( permission::read | permission::write ) );
+static_assert( to_enum< permission >( "all" ) == permission::all );
+static_assert( to_enum< permission >( "none" ) == permission::none );
+static_assert( to_enum< permission >( "" ) == permission::none );
+static_assert( to_enum< permission >( "  " ) == permission::none );
+static_assert( to_enum< access_mode >( "" ) == std::nullopt );
+static_assert( to_enum< access_mode >( " " ) == std::nullopt );
+static_assert( to_enum< access_mode >( "write|read" ) == access_mode( 3 ) );
+static_assert( !is_valid< access_mode >( 0 ) ); // no zero value registered, like `to_enum< access_mode >( "" )`
+static_assert( is_valid< access_mode >( 3 ) );
+static_assert( to_enum< access_mode >( 0 ) == std::nullopt );
+static_assert( to_enum< permission >( "read|" ) == std::nullopt );
+static_assert( to_enum< permission >( "read|foo" ) == std::nullopt );
+static_assert( to_enum< permission >( 0b0011 ) == ( permission::read | permission::write ) );
+static_assert( to_enum< permission >( 0b0100 ) == std::nullopt );
+
+static_assert( flags_to_string( permission::read | permission::execute ) == "read|execute" );
+static_assert( flags_to_string( permission::write ) == "write" );
+static_assert( flags_to_string( permission::none ) == "none" );
+static_assert( flags_to_string( permission::all, ", " ) == "read, write, execute" );
+static_assert( to_string( permission::read | permission::execute ) == "read|execute" );
+static_assert( to_string( permission::none ) == "none" );
+static_assert( to_string( access_mode( 3 ) ) == "read|write" );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static_assert( to_enum< log_level >( "Debug", case_insensitive_match {} ) == log_level::debug );
+static_assert( to_enum< log_level >( "FATAL_ERROR", case_insensitive_match {} ) == log_level::fatal_error );
+static_assert( to_enum< log_level >( "fatal-error", case_insensitive_match {} ) == std::nullopt );
+static_assert( to_enum< log_level >( "fatal-error", separator_insensitive_match {} ) == log_level::fatal_error );
+static_assert( to_enum< log_level >( "Fatal-Error", separator_insensitive_match {} ) == std::nullopt );
+static_assert( to_enum< log_level >( "Fatal-Error", normalized_match {} ) == log_level::fatal_error );
+static_assert( to_enum< log_level >( "Warn", normalized_match {} ) == std::nullopt );
+static_assert( to_enum< log_level >( "info", exact_match {} ) == log_level::info );
+static_assert( to_enum< sorted_opcode >( "LOAD", case_insensitive_match {} ) == sorted_opcode::load );
+static_assert( to_enum< sorted_opcode >( "LOADS", case_insensitive_match {} ) == std::nullopt );
+
+static_assert( impl::folded_enum_table< mixed_case, exact_match >.unambiguous );
+static_assert( !impl::folded_enum_table< mixed_case, case_insensitive_match >.unambiguous );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static_assert( to_string( packed_opcode::store ) == "store" );
+static_assert( to_enum< packed_opcode >( "sub" ) == packed_opcode::sub );
+static_assert( to_enum< packed_opcode >( "subs" ) == std::nullopt );
+static_assert( to_enum< packed_opcode >( 4 ) == packed_opcode::sub );
+static_assert( !is_valid< packed_opcode >( 5 ) );
+static_assert( std::string_view { to_c_str( packed_opcode::add ) } == "add" );
+static_assert( to_c_str( packed_opcode::add )[ 3 ] == '\0' );
+
+static_assert( to_string( sorted_opcode::store ) == "store" );
+static_assert( to_enum< sorted_opcode >( "nop" ) == sorted_opcode::nop );
+static_assert( to_enum< sorted_opcode >( "nope" ) == std::nullopt );
+static_assert( is_valid< sorted_opcode >( 21 ) );
+static_assert( !is_valid< sorted_opcode >( 22 ) );
+static_assert( std::string_view { to_c_str( bar::c ) } == "c" );
+
+static_assert( table_footprint< opcode >( string_layout::packed ) < table_footprint< opcode >() / 2 );
+static_assert( table_footprint< packed_opcode >() == table_footprint< packed_opcode >( string_layout::packed ) );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static_assert( impl::enum_table< opcode >.uses_perfect_hash );
+static_assert( !impl::enum_table< sorted_opcode >.uses_perfect_hash );
+
+static_assert( string_compare_strategy< token >::value == string_compare::word_keys );
+static_assert( string_compare_strategy< long_token >::value == string_compare::string_views );
+static_assert( string_compare_strategy< packed_opcode >::value == string_compare::string_views );
+static_assert( impl::uses_word_keys< token > );
+static_assert( !impl::uses_word_keys< long_token > );
+static_assert( !impl::uses_word_keys< packed_opcode > );
+static_assert( !impl::uses_word_keys< string_view_token > );
+static_assert( table_footprint< string_view_token >() < table_footprint< token >() );
+static_assert( impl::word_key_enum_table< token >.number_of_words == 2 );
+static_assert( impl::word_key_enum_table< foo >.number_of_words == 1 );
+static_assert( impl::word_key_enum_table< token >.uses_perfect_hash );
+static_assert( !impl::word_key_enum_table< sorted_token >.uses_perfect_hash );
+static_assert( to_enum< token >( "abcdefghijklmnop" ) == token::abcdefghijklmnop );
+static_assert( to_enum< sorted_token >( "abcdefgh" ) == sorted_token::abcdefgh );
+static_assert( to_enum< long_token >( "abcdefghijklmnopq" ) == long_token::abcdefghijklmnopq );
+
+static_assert( std::ranges::all_of( all_enum_values< opcode >, []( opcode op ) {
+    return to_enum< opcode >( to_string( op ) ) == op;
+} ) );
+static_assert( to_enum< opcode >( "" ) == std::nullopt );
+static_assert( to_enum< opcode >( "jump_if" ) == std::nullopt );
+static_assert( to_enum< opcode >( "pops" ) == std::nullopt );
+
+static_assert( to_enum< sorted_opcode >( "store" ) == sorted_opcode::store );
+static_assert( to_enum< sorted_opcode >( "stor" ) == std::nullopt );
+
 //----------------------------------------------------------------------------------------------------------------------
 
 TEST_CASE( "enums" )
@@ -68,6 +591,11 @@ TEST_CASE( "enums" )
 
     CHECK( to_enum< bar >( 2 ) == bar::a );
     CHECK( to_enum< bar >( 3 ) == std::nullopt );
+
+    CHECK( to_string( status::error ) == "error" );
+    CHECK( to_enum< status >( "ok" ) == status::ok );
+    CHECK( to_enum< status >( 4 ) == status::error );
+    CHECK( to_enum< status >( 3 ) == std::nullopt );
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -89,9 +617,348 @@ TEST_CASE( "values" )
 
 //----------------------------------------------------------------------------------------------------------------------
 
+TEST_CASE( "enum_switch" )
+{
+    for ( opcode op : all_enum_values< opcode > ) {
+        std::string_view name = enum_switch( op, []< opcode Value >() {
+            return to_string( Value );
+        } );
+        CHECK( name == to_string( op ) );
+    }
+
+    // visitors are forwarded, so they can carry state
+    status_recorder visitor;
+
+    enum_switch( status::error, visitor );
+    enum_switch( status::ok, visitor );
+    CHECK( visitor.visited == std::vector { status::error, status::ok } );
+
+    std::vector< bar > values;
+    enum_for_each< bar >( [ & ]< bar Value >() {
+        values.push_back( Value );
+    } );
+    CHECK( std::ranges::equal( values, all_enum_values< bar > ) );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST_CASE( "enum_cast" )
+{
+    for ( foo value : all_enum_values< foo > ) {
+        CHECK( enum_cast< bar >( value ) == to_enum< bar >( to_string( value ) ) );
+        CHECK( enum_cast< wire_foo >( value ) == to_enum< wire_foo >( to_string( value ) ) );
+    }
+    for ( wire_foo value : all_enum_values< wire_foo > )
+        CHECK( enum_cast< foo >( value ) == to_enum< foo >( to_string( value ) ) );
+
+    CHECK( enum_cast< foo >( foo( 3 ) ) == std::nullopt );
+    CHECK( enum_cast< foo >( bar( 3 ) ) == std::nullopt );
+
+    CHECK( enum_cast< permission >( permission::write ) == permission::write );
+    CHECK( enum_cast< permission >( permission::read | permission::write ) == std::nullopt );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST_CASE( "rank encoding" )
+{
+    for ( error_catalog value : all_enum_values< error_catalog > )
+        CHECK( decode_rank< error_catalog >( encode_rank( value ) ) == value );
+    for ( permission value : all_enum_values< permission > )
+        CHECK( decode_rank< permission >( encode_rank( value ) ) == value );
+
+    CHECK( decode_rank< error_catalog >( 200 ) == std::nullopt );
+    CHECK( decode_rank< error_catalog >( 255 ) == std::nullopt );
+
+    CHECK( schema_fingerprint< error_catalog > != schema_fingerprint< error_code > );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+// all names, their prefixes and names with an appended character are looked up like via `std::string_view`
+template < typename EnumType >
+void check_word_keys()
+{
+    for ( EnumType value : all_enum_values< EnumType > ) {
+        const std::string name { to_string( value ) };
+        CHECK( to_enum< EnumType >( name ) == value );
+
+        for ( size_t length = 0; length != name.size(); ++length )
+            CHECK( to_enum< EnumType >( name.substr( 0, length ) )
+                   == impl::enum_table< EnumType >.to_enum( name.substr( 0, length ) ) );
+
+        for ( char c : { '\0', 'a', 'z', '~' } )
+            CHECK( to_enum< EnumType >( name + c ) == impl::enum_table< EnumType >.to_enum( name + c ) );
+    }
+    CHECK( to_enum< EnumType >( std::string_view { "abcdefg\0", 8 } ) == std::nullopt );
+    CHECK( to_enum< EnumType >( "abcdefghijklmnopq" ) == std::nullopt );
+    CHECK( to_enum< EnumType >( "abcdefghijklmnopqrstuvwxyz" ) == std::nullopt );
+}
+
+} // namespace
+
+TEST_CASE( "word keys" )
+{
+    check_word_keys< token >();
+    check_word_keys< sorted_token >();
+    check_word_keys< sorted_opcode >();
+    check_word_keys< opcode >();
+    check_word_keys< string_view_token >();
+
+    for ( utf8_token value : all_enum_values< utf8_token > ) {
+        CHECK( to_enum< utf8_token >( to_string( value ) ) == value );
+        CHECK( to_enum< utf8_token >( to_string( value ), case_insensitive_match {} ) == value );
+    }
+    CHECK( std::ranges::is_sorted( all_enum_strings< utf8_token > ) );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST_CASE( "eytzinger layout" )
+{
+    for ( error_catalog value : all_enum_values< error_catalog > ) {
+        const int underlying = int( value );
+        CHECK( is_valid< error_catalog >( underlying ) );
+        CHECK( !is_valid< error_catalog >( underlying + 1 ) );
+        CHECK( !is_valid< error_catalog >( underlying - 1 ) );
+        CHECK( to_enum< error_catalog >( to_string( value ) ) == value );
+    }
+    CHECK( to_string( error_catalog::code_0 ) == "code_0" );
+    CHECK( to_string( error_catalog::code_123 ) == "code_123" );
+    CHECK( !is_valid< error_catalog >( std::numeric_limits< int >::min() ) );
+    CHECK( !is_valid< error_catalog >( std::numeric_limits< int >::max() ) );
+
+    for ( error_code value : all_enum_values< error_code > )
+        CHECK( to_enum< error_code >( int64_t( value ) ) == value );
+    CHECK( !is_valid< error_code >( 1 ) );
+    CHECK( !is_valid< error_code >( -2147483647 ) );
+    CHECK( !is_valid< error_code >( uint32_t( 2147483648u ) ) );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST_CASE( "perfect hash" )
+{
+    for ( size_t index = 0; index != number_of_elements< opcode >; ++index )
+        CHECK( index_of( from_index< opcode >( index ) ) == index );
+    for ( size_t index = 0; index != number_of_elements< sorted_opcode >; ++index )
+        CHECK( index_of( from_index< sorted_opcode >( index ) ) == index );
+
+    for ( opcode op : all_enum_values< opcode > ) {
+        CHECK( to_enum< opcode >( to_string( op ) ) == op );
+        CHECK( to_enum< opcode >( std::string( to_string( op ) ) + "_" ) == std::nullopt );
+    }
+
+    CHECK( to_enum< opcode >( "NOP" ) == std::nullopt );
+    CHECK( to_enum< opcode >( "NOP", case_insensitive_match {} ) == opcode::nop );
+    CHECK( to_enum< opcode >( "Jump-If-Zero", normalized_match {} ) == opcode::jump_if_zero );
+    CHECK( to_enum< sorted_opcode >( "load" ) == sorted_opcode::load );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static_assert( parse_prefix< opcode >( "jump_if_zero r0" )->value == opcode::jump_if_zero );
+static_assert( parse_prefix< opcode >( "jump_if_zero r0" )->length == 12 );
+
+TEST_CASE( "parse prefix" )
+{
+    auto jump = parse_prefix< opcode >( "jump_if_z" );
+    REQUIRE( jump );
+    CHECK( jump->value == opcode::jump );
+    CHECK( jump->length == 4 );
+
+    CHECK( parse_prefix< opcode >( "jump_if_not_zero" )->length == 16 );
+    CHECK( parse_prefix< log_level >( "warning;..." )->value == log_level::warning );
+    CHECK( parse_prefix< bar >( "c" )->value == bar::c );
+    CHECK( parse_prefix< opcode >( "jum" ) == std::nullopt );
+    CHECK( parse_prefix< opcode >( "" ) == std::nullopt );
+    CHECK( parse_prefix< opcode >( "x" ) == std::nullopt );
+
+    CHECK( parse_prefix< utf8_token >( "xaaaaaaaaaé;" )->value == utf8_token::xaaaaaaaaaé );
+    CHECK( parse_prefix< utf8_token >( "xaaaaaaaaaz;" )->value == utf8_token::xaaaaaaaaaz );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST_CASE( "bulk conversion" )
+{
+    using namespace std::string_view_literals;
+
+    auto strings = std::array {
+        "push"sv, "pop"sv, "nop"sv, "invalid"sv, "call"sv, "ret"sv, "add"sv, ""sv, "sub"sv, "jump"sv,
+    };
+
+    std::array< std::optional< opcode >, strings.size() > optionals;
+    CHECK( to_enum_bulk< opcode >( strings, optionals ) == 8 );
+    for ( size_t index = 0; index != strings.size(); ++index )
+        CHECK( optionals[ index ] == to_enum< opcode >( strings[ index ] ) );
+
+    std::array< opcode, strings.size() > values {};
+    std::array< uint64_t, 1 >            valid_bits { ~uint64_t( 0 ) };
+    CHECK( to_enum_bulk< opcode >( strings, values, valid_bits ) == 8 );
+    CHECK( valid_bits[ 0 ] == 0b1101110111 );
+    CHECK( values[ 9 ] == opcode::jump );
+
+    std::array< std::optional< sorted_opcode >, 3 > sorted;
+    CHECK( to_enum_bulk< sorted_opcode >( std::array { "load"sv, "nop"sv, "stor"sv }, sorted ) == 2 );
+    CHECK( sorted[ 0 ] == sorted_opcode::load );
+    CHECK( sorted[ 2 ] == std::nullopt );
+
+    constexpr std::string_view buffer = "okerrorwarningfoo";
+    constexpr auto             offsets = std::array< uint32_t, 5 > { 0, 2, 7, 14, 17 };
+
+    std::array< std::optional< status >, 4 > statuses;
+    CHECK( to_enum_bulk< status >( buffer, offsets, statuses ) == 3 );
+    CHECK( statuses == std::array< std::optional< status >, 4 > { status::ok, status::error, status::warning, {} } );
+
+    // flags are parsed like by `to_enum`
+    auto flag_strings = std::array { "read|write"sv, "none"sv, ""sv, "execute | read"sv, "read|"sv, "all"sv };
+
+    std::array< std::optional< permission >, flag_strings.size() > flags;
+    CHECK( to_enum_bulk< permission >( flag_strings, flags ) == 5 );
+    for ( size_t index = 0; index != flag_strings.size(); ++index )
+        CHECK( flags[ index ] == to_enum< permission >( flag_strings[ index ] ) );
+
+    std::array< std::optional< access_mode >, flag_strings.size() > access_modes;
+    CHECK( to_enum_bulk< access_mode >( flag_strings, access_modes ) == 1 );
+    CHECK( access_modes[ 0 ] == access_mode( 3 ) );
+
+    std::array< std::optional< packed_opcode >, 3 > packed;
+    CHECK( to_enum_bulk< packed_opcode >( std::array { "add"sv, "mul"sv, "sub"sv }, packed ) == 2 );
+    CHECK( packed[ 2 ] == packed_opcode::sub );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+// compares the bulk functions with `is_valid`, for all registered values, their neighbours and the limits of `IntType`
+template < typename EnumType, typename IntType >
+void check_bulk_validation()
+{
+    std::vector< IntType > ints { std::numeric_limits< IntType >::min(), std::numeric_limits< IntType >::max(), 0 };
+    for ( EnumType value : all_enum_values< EnumType > )
+        for ( int delta : { -1, 0, 1, 0, 2 } )
+            ints.push_back( IntType( to_underlying( value ) + delta ) );
+    for ( size_t index = 0; index != 100; ++index ) // more than one block
+        ints.push_back( IntType( index * 37 ) );
+
+    std::vector< uint64_t > valid_bits( ( ints.size() + 63 ) / 64 );
+    const size_t            valid = validate_all< EnumType >( ints, valid_bits );
+
+    size_t expected_valid = 0;
+    size_t first_invalid  = ints.size();
+    for ( size_t index = 0; index != ints.size(); ++index ) {
+        const bool expected = is_valid< EnumType >( ints[ index ] );
+        CHECK( bool( ( valid_bits[ index / 64 ] >> ( index % 64 ) ) & 1 ) == expected );
+        expected_valid += expected;
+        if ( !expected )
+            first_invalid = std::min( first_invalid, index );
+    }
+    CHECK( valid == expected_valid );
+    CHECK( validate_all< EnumType >( ints ) == first_invalid );
+
+    std::vector< EnumType > values( ints.size(), all_enum_values< EnumType >[ 0 ] );
+    std::ranges::fill( valid_bits, 0 );
+    CHECK( to_enum_bulk< EnumType >( ints, values, valid_bits ) == expected_valid );
+    for ( size_t index = 0; index != ints.size(); ++index )
+        CHECK( values[ index ]
+               == to_enum< EnumType >( ints[ index ] ).value_or( all_enum_values< EnumType >[ 0 ] ) );
+
+    // all valid
+    std::vector< IntType > representable;
+    for ( EnumType value : all_enum_values< EnumType > )
+        if ( std::in_range< IntType >( to_underlying( value ) ) )
+            representable.push_back( IntType( to_underlying( value ) ) );
+
+    std::vector< IntType > valid_ints;
+    for ( size_t index = 0; index != 150; ++index )
+        valid_ints.push_back( representable[ index % representable.size() ] );
+    std::vector< EnumType > converted( valid_ints.size() );
+    CHECK( to_enum_bulk< EnumType >( valid_ints, converted ) == valid_ints.size() );
+    CHECK( int( converted[ 149 ] ) == int( valid_ints[ 149 ] ) );
+
+    valid_ints[ 100 ] = ints[ first_invalid ];
+    CHECK( to_enum_bulk< EnumType >( valid_ints, converted ) == 100 );
+}
+
+} // namespace
+
+TEST_CASE( "bulk integer conversion" )
+{
+    check_bulk_validation< foo, int >();             // ordinal
+    check_bulk_validation< foo, uint8_t >();         //
+    check_bulk_validation< status, int16_t >();      // dense
+    check_bulk_validation< offset_enum, int64_t >(); // dense, negative
+    check_bulk_validation< bar, int >();             // sparse
+    check_bulk_validation< bar, int8_t >();          // sparse, not all representable
+    check_bulk_validation< error_code, int64_t >();  // sparse, compared
+    check_bulk_validation< error_catalog, int >();   // sparse, eytzinger
+    check_bulk_validation< permission, unsigned >(); // flags
+    check_bulk_validation< access_mode, int >();     // flags without zero value
+
+    const int16_t           c_array[] = { 0, 2, 3 };
+    std::array< foo, 3 >    values {};
+    std::vector< uint64_t > valid_bits( 1 );
+    CHECK( validate_all< foo >( c_array ) == 2 );
+    CHECK( validate_all< foo >( std::array { 1, 0 } ) == 2 );
+    CHECK( to_enum_bulk< foo >( c_array, values ) == 2 );
+    CHECK( to_enum_bulk< foo >( c_array, values, valid_bits ) == 2 );
+    CHECK( valid_bits[ 0 ] == 0b011 );
+    CHECK( values[ 1 ] == foo::c );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static_assert( to_string_bulk_size( std::array { foo::a, foo::c, foo::b }, ", " ) == 7 );
+static_assert( to_string_bulk_size( std::array< foo, 0 > {}, ", " ) == 0 );
+
+TEST_CASE( "bulk serialization" )
+{
+    auto values = std::vector { status::ok, status::error, status::warning, status::ok };
+
+    std::string joined;
+    to_string_bulk( values, "|", std::back_inserter( joined ) );
+    CHECK( joined == "ok|error|warning|ok" );
+
+    std::string buffer( to_string_bulk_size( values, ", " ), '\0' );
+    CHECK( to_string_bulk( values, ", ", std::span { buffer } ) == buffer.size() );
+    CHECK( buffer == "ok, error, warning, ok" );
+
+    std::string no_separator( to_string_bulk_size( std::span { values }.first( 2 ) ), '\0' );
+    to_string_bulk( std::span { values }.first( 2 ), {}, std::span { no_separator } );
+    CHECK( no_separator == "okerror" );
+
+    // flags are written like `to_string`
+    auto flags = std::array { permission::read | permission::write, permission::none, permission::all };
+    CHECK( to_string_bulk_size( flags, ", " ) == 36 );
+    std::string flag_names( to_string_bulk_size( flags, ", " ), '\0' );
+    CHECK( to_string_bulk( flags, ", ", std::span { flag_names } ) == flag_names.size() );
+    CHECK( flag_names == "read|write, none, read|write|execute" );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 TEST_CASE( "format" )
 {
     CHECK( fmt::format( "{}", foo::a ) == "a" );
+    CHECK( fmt::format( "{}", permission::read | permission::write ) == "read|write" );
+
+    // format spec
+    CHECK( fmt::format( "[{:>4}]", foo::a ) == "[   a]" );
+    CHECK( fmt::format( "[{:*<4}]", bar::b ) == "[b***]" );
+    CHECK( fmt::format( "[{:^12}]", permission::read | permission::write ) == "[ read|write ]" );
+    CHECK( fmt::format( "[{:.2}]", permission::read | permission::write ) == "[re]" );
+
+    // only registered enums are formattable
+    enum class unregistered
+    {
+        x,
+    };
+    static_assert( fmt::is_formattable< foo >::value );
+    static_assert( !fmt::is_formattable< unregistered >::value );
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -106,7 +973,7 @@ struct my_string_view
 template <>
 struct string_adapter< my_string_view >
 {
-    my_string_view operator()( std::string_view sv ) const
+    constexpr my_string_view operator()( std::string_view sv ) const
     {
         return my_string_view {
             .sv = sv,
@@ -114,6 +981,23 @@ struct string_adapter< my_string_view >
     }
 };
 
+template <>
+struct string_adapter< std::string >
+{
+    std::string operator()( std::string_view sv ) const
+    {
+        return std::string { sv };
+    }
+};
+
+static_assert( impl::constexpr_adapted_table< foo, my_string_view > );
+static_assert( !impl::constexpr_adapted_table< foo, std::string > );
+static_assert( to_string< my_string_view >( bar::b ).sv == "b" );
+static_assert( to_enum< bar >( my_string_view { .sv = "c" } ) == bar::c );
+
+// dynamically initialized, like a static initializer in another translation unit
+const std::string statically_initialized_name = to_string< std::string >( status::error );
+
 TEST_CASE( "enums string adaptor" )
 {
     auto asv = my_string_view {
@@ -131,6 +1015,16 @@ TEST_CASE( "enums string adaptor" )
     CHECK( to_string< my_string_view >( foo::a ) == asv );
     CHECK( to_enum< foo >( asv ) == foo::a );
 
+    CHECK( to_string< my_string_view >( status::ok ) == my_string_view { .sv = "ok" } );
+    CHECK( to_string< my_string_view >( bar::c ) == csv );
+    CHECK( to_enum< status >( my_string_view { .sv = "error" } ) == status::error );
+
+    const std::string& a = to_string< std::string >( foo::a );
+    CHECK( a == "a" );
+    CHECK( &a == &to_string< std::string >( foo::a ) );
+    CHECK( to_string< std::string >( bar::c ) == "c" );
+    CHECK( statically_initialized_name == "error" );
+
     auto string_values = { asv, bsv, csv };
     auto enum_strings  = all_enum_strings< foo, my_string_view >;
     CHECK_THAT( enum_strings, Catch::Matchers::RangeEquals( string_values ) );
@@ -138,6 +1032,51 @@ TEST_CASE( "enums string adaptor" )
 
 //----------------------------------------------------------------------------------------------------------------------
 
+static_assert( impl::constexpr_adapted_table< bar, std::u16string_view > );
+static_assert( to_string< std::u8string_view >( foo::b ) == u8"b" );
+static_assert( to_string< std::u16string_view >( bar::c ) == u"c" );
+static_assert( to_string< std::u32string_view >( status::error ) == U"error" );
+static_assert( to_string< std::wstring_view >( opcode::mul ) == L"mul" );
+static_assert( to_enum< bar >( std::u16string_view { u"b" } ) == bar::b );
+static_assert( to_enum< bar >( u"d" ) == std::nullopt );
+static_assert( to_enum< error_catalog >( U"code_199" ) == error_catalog::code_199 );
+static_assert( all_enum_strings< foo, std::wstring_view > == std::array< std::wstring_view, 3 > { L"a", L"b", L"c" } );
+
+namespace {
+
+template < typename CharT >
+constexpr std::basic_string< CharT > transcoded( std::string_view sv )
+{
+    std::basic_string< CharT > ret;
+    impl::transcode_utf8< CharT >( sv, [ & ]( CharT c ) {
+        ret.push_back( c );
+    } );
+    return ret;
+}
+
+} // namespace
+
+static_assert( transcoded< char16_t >( "a\xc3\xbc\xe2\x82\xac\xf0\x9f\x98\x80" ) == u"a\u00fc\u20ac\U0001F600" );
+static_assert( transcoded< char32_t >( "a\xc3\xbc\xe2\x82\xac\xf0\x9f\x98\x80" ) == U"a\u00fc\u20ac\U0001F600" );
+static_assert( transcoded< char8_t >( "a\xc3\xbc" ) == u8"a\u00fc" );
+
+TEST_CASE( "unicode strings" )
+{
+    for ( opcode op : all_enum_values< opcode > ) {
+        const std::u16string_view name = to_string< std::u16string_view >( op );
+        CHECK( std::ranges::equal( name, to_string( op ) ) );
+        CHECK( name.data()[ name.size() ] == u'\0' );
+        CHECK( to_enum< opcode >( name ) == op );
+        CHECK( to_enum< opcode >( std::u16string { name } ) == op );
+    }
+
+    // the names point to static storage
+    CHECK( to_string< std::wstring_view >( foo::a ).data() == to_string< std::wstring_view >( foo::a ).data() );
+    CHECK( to_enum< permission >( std::u32string_view { U"write" } ) == permission::write );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 
 } // namespace nova::enums
 
@@ -148,6 +1087,8 @@ TEST_CASE( "enums string adaptor" )
 TEST_CASE( "std_format" )
 {
     CHECK( std::format( "{}", foo::a ) == "a" );
+    CHECK( std::format( "[{:>4}]", foo::a ) == "[   a]" );
+    CHECK( std::format( "[{:^12}]", permission::read | permission::write ) == "[ read|write ]" );
 }
 
 #endif
@@ -0,0 +1,58 @@
+#define NOVA_ENUMS_FORMAT_NUMERIC_FALLBACK 1
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/enums/enums.hpp>
+
+#include <fmt/format.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace format_fallback_test {
+
+enum class color : int8_t
+{
+    red,
+    green,
+    blue,
+};
+
+enum class permission
+{
+    read    = 1,
+    write   = 2,
+    execute = 4,
+};
+
+enum class unregistered : uint64_t
+{
+    big = 18446744073709551615u,
+};
+
+} // namespace format_fallback_test
+
+NOVA_ENUMS_REGISTER( format_fallback_test::color, red, green, blue );
+NOVA_ENUMS_REGISTER_FLAGS( format_fallback_test::permission, read, write, execute );
+
+using namespace format_fallback_test;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST_CASE( "format, numeric fallback" )
+{
+    CHECK( fmt::format( "{}", color::green ) == "green" );
+    CHECK( fmt::format( "{}", color( 3 ) ) == "3" );
+    CHECK( fmt::format( "{}", color( -128 ) ) == "-128" );
+    CHECK( fmt::format( "[{:>5}]", color( 7 ) ) == "[    7]" );
+
+    CHECK( fmt::format( "{}", permission( 5 ) ) == "read|execute" );
+    CHECK( fmt::format( "{}", permission( 8 ) ) == "8" );
+
+    CHECK( fmt::format( "{}", unregistered::big ) == "18446744073709551615" );
+    CHECK( fmt::format( "{}", unregistered( 0 ) ) == "0" );
+
+#ifdef __cpp_lib_format
+    CHECK( std::format( "{}", color( 3 ) ) == "3" );
+    CHECK( std::format( "{}", unregistered( 0 ) ) == "0" );
+#endif
+}
@@ -0,0 +1,48 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <generated/generated_test_registrations.hpp>
+
+#include <string>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace nova::enums {
+
+using namespace generated_test;
+
+static_assert( is_registered_enum_v< ordinal > );
+static_assert( is_ordinal_v< ordinal > );
+static_assert( impl::kind_of_table< dense > == impl::table_kind::dense );
+static_assert( impl::kind_of_table< sparse > == impl::table_kind::sparse );
+static_assert( is_flags_enum_v< permission > );
+
+static_assert( number_of_elements< sparse > == 4 );
+static_assert( all_enum_values< sparse >
+               == std::array { sparse::small, sparse::medium, sparse::large, sparse::largest } );
+static_assert( all_enum_values< dense > == std::array { dense::minus_two, dense::one, dense::two } );
+static_assert( all_enum_strings< ordinal > == std::array< std::string_view, 4 > { "one", "three", "two", "zero" } );
+
+TEST_CASE( "generated registrations" )
+{
+    CHECK( to_enum< ordinal >( "three" ) == ordinal::three );
+    CHECK( to_enum< ordinal >( "four" ) == std::nullopt );
+    CHECK( to_string( ordinal::two ) == "two" );
+
+    CHECK( to_enum< dense >( "minus_two" ) == dense::minus_two );
+    CHECK( to_enum< dense >( "minus" ) == std::nullopt );
+    CHECK( is_valid< dense >( -2 ) );
+    CHECK( !is_valid< dense >( 0 ) );
+
+    CHECK( to_enum< sparse >( "largest" ) == sparse::largest );
+    CHECK( to_string( sparse::large ) == "large" );
+    CHECK( to_enum< sparse >( uint64_t( 70'000 ) ) == sparse::medium );
+    CHECK( !is_valid< sparse >( 4 ) );
+
+    CHECK( to_enum< permission >( "read|execute" ) == permission( 5 ) );
+    CHECK( flags_to_string( permission( 3 ) ) == "read|write" );
+
+    CHECK( to_enum< sparse >( "LARGE", case_insensitive_match {} ) == sparse::large );
+    CHECK( index_of( sparse::largest ) == 3 );
+}
+
+} // namespace nova::enums
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <nova/enums/enums.hpp>
+
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------------------------
+// enums which are registered via nova_enums_generate
+
+namespace generated_test {
+
+enum class ordinal
+{
+    zero,
+    one,
+    two,
+    three,
+};
+
+enum class dense : int8_t
+{
+    minus_two = -2,
+    one       = 1,
+    two       = 2,
+};
+
+enum class sparse : uint64_t
+{
+    small   = 3,
+    large   = 1'000'000'000'000,
+    largest = 18'446'744'073'709'551'615u,
+    medium  = 70'000,
+};
+
+enum class permission
+{
+    none    = 0,
+    read    = 1,
+    write   = 2,
+    execute = 4,
+};
+
+} // namespace generated_test
+
+template <>
+struct nova::enums::string_lookup_strategy< generated_test::dense > :
+    std::integral_constant< nova::enums::string_lookup, nova::enums::string_lookup::sorted_table >
+{};
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "generated_test_enums.hpp"
+
+//----------------------------------------------------------------------------------------------------------------------
+// only compiled into the generator, other translation units include the generated header
+
+NOVA_ENUMS_REGISTER( generated_test::ordinal, zero, one, two, three );
+NOVA_ENUMS_REGISTER( generated_test::dense, two, minus_two, one );
+NOVA_ENUMS_REGISTER( generated_test::sparse, small, large, largest, medium );
+NOVA_ENUMS_REGISTER_FLAGS( generated_test::permission, none, read, write, execute );
@@ -0,0 +1,151 @@
+#define NOVA_ENUMS_ENABLE_INSTRUMENTATION 1
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/enums/enums.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace instrumentation_test {
+
+enum class color
+{
+    red,
+    green,
+    blue,
+};
+
+enum class sparse
+{
+    a = 10,
+    b = 1000,
+};
+
+enum class unused
+{
+    x,
+};
+
+} // namespace instrumentation_test
+
+NOVA_ENUMS_REGISTER( instrumentation_test::color, red, green, blue );
+NOVA_ENUMS_REGISTER( instrumentation_test::sparse, a, b );
+NOVA_ENUMS_REGISTER( instrumentation_test::unused, x );
+
+using namespace nova::enums;
+using namespace instrumentation_test;
+using instrumentation::operation;
+
+namespace {
+
+std::optional< instrumentation::enum_counts > counts_of( std::string_view name )
+{
+    std::vector< instrumentation::enum_counts > snapshot = instrumentation::snapshot();
+
+    auto it = std::ranges::find( snapshot, name, &instrumentation::enum_counts::enum_name );
+    if ( it == snapshot.end() )
+        return std::nullopt;
+    return *it;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST_CASE( "instrumentation" )
+{
+    instrumentation::reset();
+
+    // constant evaluation is not counted
+    static_assert( to_enum< color >( "red" ) == color::red );
+
+    REQUIRE( to_enum< color >( "red" ) == color::red );
+    REQUIRE( to_enum< color >( "green" ) == color::green );
+    REQUIRE( to_enum< color >( "purple" ) == std::nullopt );
+    REQUIRE( to_enum< color >( "RED", case_insensitive_match {} ) == color::red );
+    REQUIRE( to_enum< color >( 2 ) == color::blue );
+    REQUIRE( to_enum< color >( 3 ) == std::nullopt );
+    REQUIRE( is_valid< color >( 1 ) );
+    REQUIRE( !is_valid< color >( -1 ) );
+    REQUIRE( to_string( color::blue ) == "blue" );
+
+    REQUIRE( to_enum< sparse >( 11 ) == std::nullopt );
+
+    std::optional< instrumentation::enum_counts > c = counts_of( "instrumentation_test::color" );
+    REQUIRE( c );
+    CHECK( ( *c )[ operation::to_enum_string ].calls == 4 );
+    CHECK( ( *c )[ operation::to_enum_string ].misses == 1 );
+    CHECK( ( *c )[ operation::to_enum_integer ].calls == 2 );
+    CHECK( ( *c )[ operation::to_enum_integer ].misses == 1 );
+    CHECK( ( *c )[ operation::is_valid ].calls == 2 );
+    CHECK( ( *c )[ operation::is_valid ].misses == 1 );
+    CHECK( ( *c )[ operation::to_string ].calls == 1 );
+    CHECK( ( *c )[ operation::to_string ].misses == 0 );
+
+    std::optional< instrumentation::enum_counts > s = counts_of( "instrumentation_test::sparse" );
+    REQUIRE( s );
+    CHECK( ( *s )[ operation::to_enum_integer ].calls == 1 );
+    CHECK( ( *s )[ operation::to_enum_integer ].misses == 1 );
+    CHECK( ( *s )[ operation::to_enum_string ].calls == 0 );
+
+    // enums without runtime lookups are not listed
+    CHECK( !counts_of( "instrumentation_test::unused" ) );
+
+    instrumentation::reset();
+    c = counts_of( "instrumentation_test::color" );
+    REQUIRE( c );
+    CHECK( ( *c )[ operation::to_enum_string ].calls == 0 );
+    CHECK( ( *c )[ operation::is_valid ].misses == 0 );
+}
+
+TEST_CASE( "instrumentation, formatting" )
+{
+    instrumentation::reset();
+
+    // names written by the library are not counted as `to_string` calls
+    std::array< color, 3 > values { color::red, color::green, color::blue };
+    CHECK( fmt::format( "{}", color::green ) == "green" );
+#ifdef __cpp_lib_format
+    CHECK( std::format( "{}", color::blue ) == "blue" );
+#endif
+    CHECK( to_string_bulk_size( values, "," ) == 14 );
+    std::string names;
+    to_string_bulk( values, ",", std::back_inserter( names ) );
+    CHECK( names == "red,green,blue" );
+    CHECK( to_string( color::red ) == "red" );
+
+    std::optional< instrumentation::enum_counts > c = counts_of( "instrumentation_test::color" );
+    REQUIRE( c );
+    CHECK( ( *c )[ operation::to_string ].calls == 1 );
+    CHECK( ( *c )[ operation::to_string ].misses == 0 );
+}
+
+TEST_CASE( "instrumentation, concurrent" )
+{
+    instrumentation::reset();
+
+    constexpr size_t number_of_threads = 8;
+    constexpr size_t iterations        = 10000;
+
+    std::vector< std::thread > threads;
+    for ( size_t thread = 0; thread != number_of_threads; ++thread )
+        threads.emplace_back( [] {
+            for ( size_t i = 0; i != iterations; ++i )
+                (void)to_enum< color >( i % 2 ? "red" : "black" );
+        } );
+    for ( std::thread& thread : threads )
+        thread.join();
+
+    std::optional< instrumentation::enum_counts > c = counts_of( "instrumentation_test::color" );
+    REQUIRE( c );
+    CHECK( ( *c )[ operation::to_enum_string ].calls == number_of_threads * iterations );
+    CHECK( ( *c )[ operation::to_enum_string ].misses == number_of_threads * iterations / 2 );
+}
@@ -0,0 +1,123 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/enums/packed_enum_vector.hpp>
+
+#include <algorithm>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace packed_enum_vector_test {
+
+enum class state
+{
+    idle,
+    running,
+    blocked,
+};
+
+enum class sparse
+{
+    a = 1000,
+    b = -5,
+    c = 70000,
+    d = 3,
+    e = 12,
+};
+
+enum class single
+{
+    only = 42,
+};
+
+} // namespace packed_enum_vector_test
+
+NOVA_ENUMS_REGISTER( packed_enum_vector_test::state, idle, running, blocked );
+NOVA_ENUMS_REGISTER( packed_enum_vector_test::sparse, a, b, c, d, e );
+NOVA_ENUMS_REGISTER( packed_enum_vector_test::single, only );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace nova::enums {
+
+using namespace packed_enum_vector_test;
+
+static_assert( packed_enum_vector< state >::bits_per_element == 2 );
+static_assert( packed_enum_vector< state >::elements_per_word == 32 );
+static_assert( packed_enum_vector< sparse >::bits_per_element == 3 );
+static_assert( packed_enum_vector< sparse >::elements_per_word == 21 );
+static_assert( packed_enum_vector< single >::bits_per_element == 1 );
+
+static_assert( [] {
+    packed_enum_vector< sparse > v { sparse::c, sparse::b };
+    v.push_back( sparse::e );
+    v[ 0 ] = sparse::a;
+    return v.size() == 3 && v[ 0 ] == sparse::a && v[ 1 ] == sparse::b && v[ 2 ] == sparse::e;
+}() );
+
+TEST_CASE( "packed_enum_vector" )
+{
+    std::vector< sparse > values;
+    for ( size_t i = 0; i != 1000; ++i )
+        values.push_back( all_enum_values< sparse >[ ( i * 7 + i / 3 ) % 5 ] );
+
+    SECTION( "push_back" )
+    {
+        packed_enum_vector< sparse > v;
+        for ( sparse value : values )
+            v.push_back( value );
+
+        REQUIRE( v.size() == values.size() );
+        CHECK( std::ranges::equal( v, values ) );
+        CHECK( v.footprint() == ( values.size() + 20 ) / 21 * 8 );
+
+        while ( v.size() > 500 )
+            v.pop_back();
+        CHECK( std::ranges::equal( v, std::span { values }.first( 500 ) ) );
+    }
+
+    SECTION( "bulk" )
+    {
+        // unaligned partial words before and after the bulk
+        packed_enum_vector< sparse > v { sparse::d, sparse::e };
+        v.pack( values );
+        REQUIRE( v.size() == values.size() + 2 );
+        CHECK( v[ 0 ] == sparse::d );
+        CHECK( v[ 1 ] == sparse::e );
+
+        const std::vector< sparse > all = v.unpack();
+        CHECK( std::ranges::equal( std::span { all }.subspan( 2 ), values ) );
+        CHECK( v == packed_enum_vector< sparse > { std::span { all } } );
+
+        for ( size_t first : { 0, 2, 21, 40 } ) {
+            std::vector< sparse > unpacked( 555 );
+            v.unpack( unpacked, first );
+            CHECK( std::ranges::equal( unpacked, std::span { all }.subspan( first, 555 ) ) );
+        }
+    }
+
+    SECTION( "modification" )
+    {
+        packed_enum_vector< state > v( 100, state::blocked );
+        CHECK( std::ranges::all_of( v, []( state s ) { return s == state::blocked; } ) );
+
+        v[ 50 ] = state::running;
+        v[ 51 ] = v[ 50 ];
+        CHECK( v[ 49 ] == state::blocked );
+        CHECK( v[ 50 ] == state::running );
+        CHECK( v[ 51 ] == state::running );
+        CHECK( v[ 52 ] == state::blocked );
+
+        // shrinking and growing does not resurrect old elements
+        v.resize( 40 );
+        v.resize( 60, state::idle );
+        CHECK( v[ 39 ] == state::blocked );
+        CHECK( v[ 40 ] == state::idle );
+        CHECK( v[ 59 ] == state::idle );
+
+        v.clear();
+        CHECK( v.empty() );
+    }
+}
+
+} // namespace nova::enums
@@ -0,0 +1,128 @@
+#define NOVA_ENUMS_ENABLE_REGISTRY 1
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/enums/enums.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace registry_test {
+
+enum class log_level
+{
+    debug,
+    info,
+    warn,
+    error,
+};
+
+enum class sparse : uint64_t
+{
+    a = 10,
+    b = 1000,
+    c = 18446744073709551615u,
+};
+
+enum class permission
+{
+    read    = 1,
+    write   = 2,
+    execute = 4,
+};
+
+enum class listed
+{
+    x,
+    y,
+};
+
+enum class registered_late
+{
+    z,
+};
+
+} // namespace registry_test
+
+NOVA_ENUMS_REGISTER( registry_test::log_level, debug, info, warn, error );
+NOVA_ENUMS_REGISTER( registry_test::sparse, a, b, c );
+NOVA_ENUMS_REGISTER_FLAGS( registry_test::permission, read, write, execute );
+NOVA_ENUMS_REGISTER_LIST( registry_test::listed, ( x, ( y, BOOST_PP_NIL ) ) );
+
+// looked up during static initialization, before `registered_late` is registered
+const bool found_during_static_initialization = nova::enums::registry::find_enum( "registry_test::listed" ) != nullptr;
+
+NOVA_ENUMS_REGISTER( registry_test::registered_late, z );
+
+using namespace nova::enums;
+using namespace registry_test;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+TEST_CASE( "registry" )
+{
+    const registry::enum_entry* entry = registry::find_enum( "registry_test::log_level" );
+    REQUIRE( entry );
+    CHECK( entry->type_name == "registry_test::log_level" );
+    CHECK( entry->number_of_elements == 4 );
+    CHECK( std::ranges::equal( entry->values, std::array< int64_t, 4 > { 0, 1, 2, 3 } ) );
+    CHECK( std::ranges::equal( entry->names, all_enum_values< log_level >, {}, {}, []( log_level value ) {
+        return to_string( value );
+    } ) );
+    CHECK( entry->fingerprint == schema_fingerprint< log_level > );
+    CHECK( entry->to_enum( "warn" ) == 2 );
+    CHECK( entry->to_enum( "fatal" ) == std::nullopt );
+
+    CHECK( registry::to_value( "registry_test::log_level::error" ) == 3 );
+    CHECK( registry::to_value( "registry_test::log_level::fatal" ) == std::nullopt );
+    CHECK( registry::to_value( "registry_test::sparse::b" ) == 1000 );
+    CHECK( registry::to_value( "registry_test::sparse::c" ) == -1 ); // converted to `int64_t`
+    CHECK( registry::to_value( "registry_test::permission::read|execute" ) == 5 );
+    CHECK( registry::to_value( "registry_test::listed::y" ) == 1 );
+    CHECK( registry::to_value( "registry_test::registered_late::z" ) == 0 );
+
+    CHECK( registry::to_value( "registry_test::unknown::a" ) == std::nullopt );
+    CHECK( registry::to_value( "log_level::warn" ) == std::nullopt );
+    CHECK( registry::to_value( "warn" ) == std::nullopt );
+    CHECK( registry::find_enum( "" ) == nullptr );
+
+    std::vector< std::string_view > type_names;
+    for ( const registry::enum_entry* e : registry::all_enums() )
+        type_names.push_back( e->type_name );
+    CHECK( type_names
+           == std::vector< std::string_view > {
+               "registry_test::log_level",
+               "registry_test::sparse",
+               "registry_test::permission",
+               "registry_test::listed",
+               "registry_test::registered_late",
+           } );
+}
+
+TEST_CASE( "registry, lookup during static initialization" )
+{
+    CHECK( found_during_static_initialization );
+    CHECK( registry::find_enum( "registry_test::registered_late" ) );
+}
+
+TEST_CASE( "registry, concurrent" )
+{
+    constexpr size_t number_of_threads = 8;
+    constexpr size_t iterations        = 10000;
+
+    std::atomic< size_t >      found;
+    std::vector< std::thread > threads;
+    for ( size_t thread = 0; thread != number_of_threads; ++thread )
+        threads.emplace_back( [ & ] {
+            for ( size_t i = 0; i != iterations; ++i )
+                found += registry::to_value( i % 2 ? "registry_test::log_level::info" : "registry_test::sparse::d" )
+                             .has_value();
+        } );
+    for ( std::thread& thread : threads )
+        thread.join();
+
+    CHECK( found == number_of_threads * iterations / 2 );
+}